@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+combo_gen.py
+Genera keymaps/combo_hash_data.h para los combos del keymap (keymaps/combo_hash.c) desde
+assets/combos.txt, con un hash perfecto sobre las posiciones de la matriz:
+  - clave del combo: las dos posiciones (fila * MATRIX_COLS + columna) ordenadas,
+    a << 6 | b
+  - slot = (uint16_t)(clave * COMBO_HASH_MULT) >> COMBO_HASH_SHIFT; el generador prueba
+    multiplicadores hasta que ningún par de combos cae en el mismo slot
+  - combo_members[]: bitmap de las posiciones que participan en algún combo
+
+En cada tecla el firmware hace a lo sumo un bit del bitmap y un slot de la tabla,
+sin importar cuántos combos haya.
+
+Las teclas se nombran por su keycode en la capa BASE de keymap.c (mismo parser que
+keymap_sparse_gen.py); tienen que ser keycodes básicos.
+
+Uso:
+  python3 combo_gen.py                     # -> keymaps/combo_hash_data.h
+  python3 combo_gen.py --check             # falla si el .h está desactualizado
+  python3 combo_gen.py --show              # combos con sus posiciones y slots
+"""
+
+import re, sys, argparse
+from pathlib import Path
+
+from keymap_sparse_gen import parse_layers, LILY58_LAYOUT_MATRIX, MATRIX_COLS, MATRIX_ROWS
+from leader_gen import custom_keycodes
+from qmk_keycodes import parse
+
+HERE = Path(__file__).resolve().parent
+SRC = HERE / "assets" / "combos.txt"
+KEYMAP = HERE / "keymaps" / "keymap.c"
+OUT = HERE / "keymaps" / "combo_hash_data.h"
+
+EMPTY = 0xFFFF
+
+def base_positions():
+    """{keycode básico: posición} de la capa BASE (la primera de keymaps[])."""
+    layer, keys = parse_layers(KEYMAP.read_text(encoding="utf-8"))[0]
+    out = {}
+    for kc, (r, c) in zip(keys, LILY58_LAYOUT_MATRIX):
+        try:
+            code = parse(kc)
+        except ValueError:
+            continue
+        if code <= 0xFF:
+            out.setdefault(code, r * MATRIX_COLS + c)
+    return out
+
+def key_code(token):
+    return parse("KC_" + token.upper()) if re.fullmatch(r"[a-zA-Z0-9]", token) else parse(token)
+
+def parse_combos(text, positions, custom):
+    """[(posición, posición, acción, texto)] con las posiciones ordenadas."""
+    out = []
+    for n, line in enumerate(text.splitlines(), 1):
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        keys, sep, action = line.partition("->")
+        keys, action = keys.split(), action.strip()
+        if not sep or len(keys) != 2 or not action:
+            sys.exit(f"❌ combos.txt:{n}: se espera 'TECLA TECLA -> ACCIÓN'")
+        try:
+            pos = sorted(positions[key_code(k)] for k in keys)
+            if action not in custom:
+                parse(action)
+        except KeyError:
+            sys.exit(f"❌ combos.txt:{n}: {' '.join(keys)}: solo teclas básicas de la capa BASE")
+        except ValueError as e:
+            sys.exit(f"❌ combos.txt:{n}: {e}")
+        if pos[0] == pos[1]:
+            sys.exit(f"❌ combos.txt:{n}: la misma tecla dos veces")
+        out.append((pos[0], pos[1], action, " ".join(keys)))
+    return out
+
+def combo_key(a, b):
+    return a << 6 | b
+
+def perfect_hash(keys):
+    """-> (mult, shift, tamaño): el primer multiplicador impar sin colisiones."""
+    bits = max(1, (len(keys) - 1).bit_length())
+    while True:
+        shift = 16 - bits
+        for mult in range(1, 1 << 16, 2):
+            slots = {((k * mult) & 0xFFFF) >> shift for k in keys}
+            if len(slots) == len(keys):
+                return mult, shift, 1 << bits
+        bits += 1
+
+def render(combos, mult, shift, size):
+    table = [None] * size
+    for a, b, action, label in combos:
+        k = combo_key(a, b)
+        table[((k * mult) & 0xFFFF) >> shift] = (k, action, label)
+    members = [0] * ((MATRIX_ROWS * MATRIX_COLS + 7) // 8)
+    for a, b, _action, _label in combos:
+        for p in (a, b):
+            members[p // 8] |= 1 << (p % 8)
+    o = ["/* Generado por combo_gen.py desde assets/combos.txt. NO editar a mano. */",
+         "#pragma once",
+         "#include <avr/pgmspace.h>",
+         "",
+         "#define COMBO_HASH_MULT  %d" % mult,
+         "#define COMBO_HASH_SHIFT %d" % shift,
+         "#define COMBO_HASH_SIZE  %d" % size,
+         "#define COMBO_HASH_EMPTY 0x%04X" % EMPTY,
+         "",
+         "/* bit p = la posición p (fila * MATRIX_COLS + columna) está en algún combo */",
+         "static const uint8_t PROGMEM combo_members[%d] = { %s };"
+         % (len(members), ", ".join("0x%02X" % v for v in members)),
+         "",
+         "/* slot -> clave (posiciones a << 6 | b) y acción */",
+         "static const uint16_t PROGMEM combo_keys[COMBO_HASH_SIZE] = {"]
+    for e in table:
+        o.append("  0x%04X,%s" % (e[0], "  // " + e[2]) if e else "  COMBO_HASH_EMPTY,")
+    o += ["};", "",
+          "static const uint16_t PROGMEM combo_actions[COMBO_HASH_SIZE] = {"]
+    for e in table:
+        o.append("  %s," % e[1] if e else "  KC_NO,")
+    o.append("};")
+    return "\n".join(o) + "\n"
+
+def main():
+    ap = argparse.ArgumentParser(description="Tabla de hash perfecto para los combos del keymap")
+    ap.add_argument("--src", default=str(SRC))
+    ap.add_argument("--out", default=str(OUT))
+    ap.add_argument("--check", action="store_true", help="solo verifica que el .h esté al día")
+    ap.add_argument("--show", action="store_true", help="imprime los combos y sus slots")
+    args = ap.parse_args()
+
+    combos = parse_combos(Path(args.src).read_text(encoding="utf-8"), base_positions(), custom_keycodes())
+    if not combos:
+        sys.exit("❌ combos.txt sin combos")
+    keys = [combo_key(a, b) for a, b, _x, _l in combos]
+    dup = {k for k in keys if keys.count(k) > 1}
+    if dup:
+        sys.exit("❌ combos repetidos: " + ", ".join(l for a, b, _x, l in combos if combo_key(a, b) in dup))
+    mult, shift, size = perfect_hash(keys)
+
+    if args.show:
+        for a, b, action, label in combos:
+            slot = ((combo_key(a, b) * mult) & 0xFFFF) >> shift
+            print(f"{label:<16} pos {a:2d}+{b:2d}  slot {slot:2d}  -> {action}")
+        print(f"\nmult {mult}, {size} slots para {len(combos)} combos")
+        return
+
+    text = render(combos, mult, shift, size)
+    out = Path(args.out)
+    if args.check:
+        if not out.exists() or out.read_text(encoding="utf-8") != text:
+            print(f"❌ {out.name} desactualizado: python3 combo_gen.py"); sys.exit(1)
+        print(f"✅ {out.name} al día.")
+        return
+    out.write_text(text, encoding="utf-8")
+    print(f"{out.name}: {len(combos)} combos en {size} slots, {4 * size + 8} bytes de flash", file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+flash_size_report.py
+Atribuye los bytes de flash/RAM del firmware Lily58 a cada feature de rules.mk
+(RGBLIGHT, OLED, NKRO, BOOTMAGIC, EXTRAKEY, lib/*.c) y a los símbolos propios del
+keymap (keymaps, process_record_user, apply_layer_lighting, bodegafresh_logo_rle).
+
+El grupo KEYMAP no sale de nombres: son los símbolos fuertes definidos en los .o del
+keymap, que 'qmk compile' deja en .build/obj_<target>/ junto al .elf:
+  - quantum/keymap_introspection.o: QMK no compila keymap.c solo, lo incluye ahí
+    (keymaps, process_record_user, oled_task_user, ...; también trae los *_raw de
+    la introspección, unos pocos bytes)
+  - los de cada SRC += de rules.mk (fuera de lib/), por nombre de archivo
+Un static con el mismo nombre que otro del core no se puede separar en el .elf: va por
+las reglas de abajo y el reporte lo nombra.
+
+La salida es texto estable (orden fijo, sin fechas) para poder hacer diff entre builds.
+
+Requisitos: avr-binutils (avr-nm, avr-size) y QMK instalado si se usa --compile.
+Uso:
+  python3 flash_size_report.py --elf lily58_rev1_bodegafresh_latam.elf
+  python3 flash_size_report.py --compile -kb lily58 -km bodegafresh_latam
+  python3 flash_size_report.py --elf x.elf --obj x/obj_dir  # .o en otro lugar
+  python3 flash_size_report.py --elf x.elf --top 5       # top N símbolos por grupo
+  python3 flash_size_report.py --elf x.elf --md          # Markdown
+  python3 flash_size_report.py --elf x.elf > nuevo.txt && diff -u viejo.txt nuevo.txt
+"""
+
+import os, re, sys, shlex, argparse, subprocess
+from pathlib import Path
+from collections import defaultdict
+
+HERE = Path(__file__).resolve().parent
+RULES_MK = HERE / "keymaps" / "rules.mk"
+
+# ---------- Símbolos propios del keymap (se reportan uno a uno) ----------
+KEYMAP_SYMBOLS = [
+    "keymaps",
+    "process_record_user",
+    "apply_layer_lighting",
+    "bodegafresh_logo_rle",
+]
+
+# ---------- Reglas de atribución: (grupo, flag de rules.mk o None, regex de símbolo) ----------
+# Para lo que no es del keymap (KEYMAP va por objetos, keymap_symbol_names()).
+# El orden importa: gana la primera regla que coincide.
+# Con LTO_ENABLE muchas funciones static se inlinean; sus bytes quedan en el llamador.
+FEATURE_RULES = [
+    ("LIB",       "SRC lib/*.c",      r"^(read_rgb_info|read_layer_state|read_logo|set_keylog|read_keylog|read_keylogs|"
+                                      r"set_timelog|read_timelog|keylog_str|keylogs_str|keylogs_str_idx|code_to_name|"
+                                      r"logo|rbuf|layer_state_str|log_timer)$"),
+    ("RGBLIGHT",  "RGBLIGHT_ENABLE",  r"(^rgblight|^ws2812|^rgb_|^led\b|^sethsv|^setrgb|breathe|RGBLED_|"
+                                      r"^animation_status|^static_effect_table|^clipping_)"),
+    ("OLED",      "OLED_ENABLE",      r"(^oled_|^font$|^i2c_|^ssd1306|^render_)"),
+    ("NKRO",      "NKRO_ENABLE",      r"(nkro)"),
+    ("BOOTMAGIC", "BOOTMAGIC_ENABLE", r"(bootmagic)"),
+    ("EXTRAKEY",  "EXTRAKEY_ENABLE",  r"(^host_system_send|^host_consumer_send|^send_extra|^last_system_usage|"
+                                      r"^last_consumer_usage|^extrakey|_extra_report)"),
+    ("SPLIT",     "SPLIT_KEYBOARD",   r"(^split_|^transport_|^serial_|^soft_serial|^is_keyboard_master|"
+                                      r"^is_keyboard_left|^transactions)"),
+    ("USB/LUFA",  None,               r"(^USB_|^Endpoint_|^CALLBACK_|^EVENT_USB|^Device|^Config|^Keyboard|"
+                                      r"^lufa|^Language|^Manufacturer|^Product|^SerialNumber)"),
+]
+
+FLASH_TYPES = set("tTrRvVwW")   # código y constantes en .text/.progmem
+RAM_TYPES   = set("dDbBgGsS")   # .data/.bss (.data también ocupa flash para su imagen inicial)
+
+# ---------- Utilidades ----------
+def run(cmd, cwd=None):
+    try:
+        out = subprocess.check_output(cmd if isinstance(cmd, list) else shlex.split(cmd),
+                                      cwd=cwd, stderr=subprocess.STDOUT)
+        return out.decode("utf-8", errors="replace")
+    except FileNotFoundError:
+        print(f"⚠️  No se encontró '{cmd[0] if isinstance(cmd, list) else cmd.split()[0]}'. "
+              "Instala avr-binutils (p. ej. apt install binutils-avr).", file=sys.stderr)
+        sys.exit(1)
+    except subprocess.CalledProcessError as e:
+        print(e.output.decode("utf-8", errors="replace"), file=sys.stderr)
+        sys.exit(e.returncode)
+
+def parse_rules_mk(path=RULES_MK):
+    """Devuelve {FLAG: 'yes'/'no'} y la lista de SRC del keymap."""
+    flags, srcs = {}, []
+    if not path.exists():
+        return flags, srcs
+    text = path.read_text(encoding="utf-8").replace("\\\n", " ")
+    for line in text.splitlines():
+        m = re.match(r"^\s*([A-Z0-9_]+)\s*[:+]?=\s*(.*)$", line)
+        if not m:
+            continue
+        key, val = m.group(1), m.group(2).strip()
+        if key == "SRC":
+            srcs += val.split()
+        else:
+            flags[key] = val
+    return flags, srcs
+
+def find_elf(kb, km):
+    """Busca el ELF que deja 'qmk compile' en <qmk_home>/.build."""
+    home = run(["qmk", "config", "user.qmk_home"]).strip().split("=", 1)[-1]
+    name = f"{kb.replace('/', '_')}_{km}"
+    build = Path(home) / ".build"
+    cands = sorted(build.glob(f"{name}*.elf")) + sorted(build.glob(f"*{km}*.elf"))
+    if not cands:
+        print(f"⚠️  No encontré {name}*.elf en {build}", file=sys.stderr); sys.exit(1)
+    return cands[0]
+
+def find_obj_dir(elf):
+    """qmk compile: .build/<target>.elf y sus objetos en .build/obj_<target>/"""
+    return Path(elf).parent / f"obj_{Path(elf).stem}"
+
+def base_name(name):
+    """los nombres con sufijo .lto_priv.N / .constprop.N se agrupan por su base"""
+    return re.sub(r"\.(lto_priv|constprop|isra|part)\.\d+.*$", "", name)
+
+KEYMAP_C_OBJ = ("quantum", "keymap_introspection.o")   # #include KEYMAP_C
+
+def keymap_objects(objs, srcs):
+    """De los .o del build, los que salen de keymap.c y de los SRC += del keymap."""
+    stems = {Path(s).stem for s in srcs if "lib/" not in s}
+    return {o for o in objs if o.parts[-2:] == KEYMAP_C_OBJ or
+            (o.stem in stems and o.parent.name != "lib")}
+
+def keymap_symbol_names(obj_dir, srcs, nm_tool):
+    """Nombres definidos con fuerza en los .o del keymap y, aparte, los que también
+    define otro .o del build (statics homónimos: no se separan en el .elf)."""
+    objs = sorted(Path(obj_dir).rglob("*.o"))
+    mine_objs = keymap_objects(objs, srcs)
+    if not mine_objs:
+        return set(), set()
+    mine, others = set(), set()
+    # con LTO los .o son GIMPLE: nm los lee con el plugin, sin tamaños pero con nombres
+    for line in run([nm_tool, "-A", "--defined-only"] + [str(o) for o in objs]).splitlines():
+        m = re.match(r"^(.+?\.o):[0-9a-fA-F]*\s+([A-Za-z])\s+(\S+)$", line)
+        if not m:
+            continue
+        obj, typ, name = Path(m.group(1)), m.group(2), base_name(m.group(3))
+        if typ in "wWvV":   # débiles: los *_user de quantum/ y los defaults de la introspección
+            continue
+        (mine if obj in mine_objs else others).add(name)
+    return mine - others, mine & others
+
+def section_sizes(elf, size_tool):
+    """avr-size -A -> {sección: bytes}"""
+    secs = {}
+    for line in run([size_tool, "-A", str(elf)]).splitlines():
+        parts = line.split()
+        if len(parts) >= 2 and parts[0].startswith(".") and parts[1].isdigit():
+            secs[parts[0]] = int(parts[1])
+    return secs
+
+def symbols(elf, nm_tool):
+    """avr-nm -S -> [(nombre, tipo, bytes)] (solo símbolos con tamaño)."""
+    syms = []
+    for line in run([nm_tool, "-S", "--size-sort", str(elf)]).splitlines():
+        parts = line.split()
+        if len(parts) != 4:
+            continue
+        _addr, size, typ, name = parts
+        syms.append((base_name(name), typ, int(size, 16)))
+    return syms
+
+def classify(name, keymap_names):
+    if name in keymap_names:
+        return "KEYMAP"
+    for group, _flag, rx in FEATURE_RULES:
+        if re.search(rx, name):
+            return group
+    return "CORE"
+
+# ---------- Reporte ----------
+def build_report(elf, nm_tool, size_tool, keymap_names):
+    secs = section_sizes(elf, size_tool)
+    groups = defaultdict(lambda: {"flash": 0, "ram": 0, "syms": defaultdict(int)})
+    per_symbol = defaultdict(lambda: [0, 0])  # nombre -> [flash, ram]
+    for name, typ, size in symbols(elf, nm_tool):
+        g = groups[classify(name, keymap_names)]
+        if typ in FLASH_TYPES:
+            g["flash"] += size; per_symbol[name][0] += size
+        elif typ in RAM_TYPES:
+            g["ram"] += size; per_symbol[name][1] += size
+            if typ in "dDgG":   # imagen inicial de .data también vive en flash
+                g["flash"] += size; per_symbol[name][0] += size
+        g["syms"][name] += size
+    return secs, groups, per_symbol
+
+def render(elf, secs, groups, per_symbol, flags, srcs, shared, top=0, mode="plain"):
+    flag_of = {g: f for g, f, _ in FEATURE_RULES}
+    lines = []
+    text, data, bss = secs.get(".text", 0), secs.get(".data", 0), secs.get(".bss", 0)
+
+    lines.append(f"# flash_size_report: {Path(elf).name}")
+    lines.append("")
+    lines.append("## Secciones")
+    for s in (".text", ".data", ".bss", ".noinit", ".eeprom"):
+        if s in secs:
+            lines.append(f"{s:<10} {secs[s]:>7}")
+    lines.append(f"{'FLASH':<10} {text + data:>7}   (.text + .data)")
+    lines.append(f"{'RAM':<10} {data + bss:>7}   (.data + .bss)")
+    lines.append("")
+
+    lines.append("## Features")
+    header = f"{'grupo':<10} {'flag':<18} {'estado':<6} {'flash':>7} {'ram':>6}"
+    lines.append(header)
+    order = ["KEYMAP"] + [g for g, _, _ in FEATURE_RULES] + ["CORE"]
+    attributed = 0
+    for g in order:
+        flag = flag_of.get(g) or "-"
+        if flag == "SRC lib/*.c":
+            state = "yes" if any("lib/" in s for s in srcs) else "no"
+        else:
+            state = flags.get(flag, "-")
+        info = groups.get(g, {"flash": 0, "ram": 0, "syms": {}})
+        attributed += info["flash"]
+        lines.append(f"{g:<10} {flag:<18} {state:<6} {info['flash']:>7} {info['ram']:>6}")
+        if top and info["syms"]:
+            for name, size in sorted(info["syms"].items(), key=lambda kv: (-kv[1], kv[0]))[:top]:
+                lines.append(f"{'':<10}   {name:<40} {size:>6}")
+    lines.append(f"{'SIN_ATRIB':<10} {'-':<18} {'-':<6} {max(0, text + data - attributed):>7} {'':>6}"
+                 "   (padding, vectores, inlines sin símbolo)")
+    if shared:
+        lines.append(f"(statics del keymap con nombre repetido en el core, atribuidos por las reglas: "
+                     f"{' '.join(sorted(shared))})")
+    lines.append("")
+
+    lines.append("## Símbolos del keymap")
+    for name in KEYMAP_SYMBOLS:
+        fl, ram = per_symbol.get(name, (0, 0))
+        note = "" if (fl or ram) else "   (inlineado por LTO o ausente)"
+        lines.append(f"{name:<28} {fl:>7} {ram:>6}{note}")
+
+    if mode == "md":
+        return "```\n" + "\n".join(lines) + "\n```"
+    return "\n".join(lines)
+
+def main():
+    ap = argparse.ArgumentParser(description="Atribución de flash/RAM por feature del Lily58")
+    ap.add_argument("--elf", help="ruta al .elf ya compilado")
+    ap.add_argument("--compile", action="store_true", help="ejecuta 'qmk compile' antes de analizar")
+    ap.add_argument("-kb", default="lily58")
+    ap.add_argument("-km", default="bodegafresh_latam")
+    ap.add_argument("--obj", help="directorio de objetos del build (por defecto obj_<elf> al lado del .elf)")
+    ap.add_argument("--nm", default="avr-nm")
+    ap.add_argument("--size", default="avr-size")
+    ap.add_argument("--top", type=int, default=0, help="lista los N símbolos más grandes por grupo")
+    ap.add_argument("--md", action="store_true", help="salida Markdown")
+    args = ap.parse_args()
+
+    if args.compile:
+        run(["qmk", "compile", "-kb", args.kb, "-km", args.km])
+    elf = Path(args.elf) if args.elf else find_elf(args.kb, args.km)
+    if not elf.exists():
+        print(f"⚠️  No existe {elf}", file=sys.stderr); sys.exit(1)
+
+    obj_dir = Path(args.obj) if args.obj else find_obj_dir(elf)
+    flags, srcs = parse_rules_mk()
+    keymap_names, shared = keymap_symbol_names(obj_dir, srcs, args.nm)
+    if not keymap_names:
+        print(f"⚠️  Sin objetos del keymap en {obj_dir}: el grupo KEYMAP queda vacío "
+              "(usa --obj).", file=sys.stderr)
+
+    secs, groups, per_symbol = build_report(elf, args.nm, args.size, keymap_names)
+    print(render(elf, secs, groups, per_symbol, flags, srcs, shared, top=args.top,
+                 mode="md" if args.md else "plain"))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,48 @@
+/*
+ * key_frames.c
+ * Arnés de las pruebas de teclas: corre el keymap en tiempo simulado (un scan +
+ * housekeeping por ms) y reporta cada tecla que le llega al host con sus mods.
+ * Lee órdenes por stdin:
+ *
+ *   key F C d|u  evento de la matriz (fila, columna)
+ *   ms N         avanza el reloj N ms, con matrix_scan_user() y housekeeping en cada uno
+ *   profile N    perfil de símbolos N (enum symbol_profile), como layout_daemon.py
+ *
+ * Por cada tecla no modificadora apretada imprime "sent 0x<keycode de 16 bits>"
+ * (mods en los bits 8..12, como S(KC_D)). Lo compila y maneja key_emulator.py.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+#include "symbol_table.h"
+
+/* mods de 8 bits del reporte a los 5 bits del keycode (bit 4 = derechos) */
+static uint8_t mods5(uint8_t m) {
+  return m & 0x0F ? (m & 0x0F) | (m >> 4) : (m >> 4 ? (m >> 4) | 0x10 : 0);
+}
+
+void host_on_key(uint8_t kc, uint8_t mods, bool pressed) {
+  if (pressed && !IS_MODIFIER_KEYCODE(kc)) printf("sent 0x%04x\n", (unsigned)(mods5(mods) << 8 | kc));
+}
+
+int main(void) {
+  keyboard_post_init_user();
+
+  char line[128];
+  while (fgets(line, sizeof line, stdin)) {
+    long n;
+    int row, col;
+    char kind;
+    if (sscanf(line, "key %d %d %c", &row, &col, &kind) == 3) host_key_event(row, col, kind == 'd');
+    else if (sscanf(line, "profile %ld", &n) == 1) symbol_set_profile(n);
+    else if (sscanf(line, "ms %ld", &n) == 1) {
+      while (n-- > 0) {
+        host_now_ms++;
+        matrix_scan_user();
+        housekeeping_task_user();
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * oled_frames.c
+ * Arnés del emulador del OLED: corre oled_task_user() del keymap sobre oled_mock.c
+ * y reporta el buffer y los bytes I2C de cada frame. Lee órdenes por stdin:
+ *
+ *   layer N [M]  layer_state = capas N, M, ... (0 = BASE)
+ *   master 0|1   mitad maestra o esclava
+ *   caps 0|1     LED de Caps Lock del host
+ *   ms N         avanza el reloj N ms
+ *   key F C d|u  evento de la matriz (fila, columna)
+ *   frame [N]    N veces: scan + housekeeping + oled_task_user() + oled_render()  -> "frame <bytes>"
+ *   dump NOMBRE  -> "dump NOMBRE <encendido> <brillo> <512 bytes en hex>"
+ *
+ * Lo compila y maneja oled_emulator.py.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+#include "oled_driver.h"
+
+bool oled_task_user(void);
+
+static void frame(void) {
+  matrix_scan_user();
+  housekeeping_task_user();
+  oled_task_user();
+  oled_render();
+  printf("frame %u\n", oled_host_take_i2c_bytes());
+}
+
+int main(void) {
+  /* oled_init(): buffer en cero y un render completo antes del primer task */
+  oled_clear();
+  oled_render();
+  oled_host_take_i2c_bytes();
+  keyboard_post_init_user();
+
+  char line[128], arg[64];
+  while (fgets(line, sizeof line, stdin)) {
+    long n = 1;
+    int row, col;
+    char kind;
+    if (!strncmp(line, "layer ", 6)) {
+      layer_state_t state = 0;
+      char *p = line + 6, *end;
+      for (n = strtol(p, &end, 10); end != p; n = strtol(p = end, &end, 10))
+        if (n) state |= (layer_state_t)1 << n;
+      host_set_layer_state(state);
+    } else if (sscanf(line, "master %ld", &n) == 1) host_master = n;
+    else if (sscanf(line, "caps %ld", &n) == 1) host_leds.caps_lock = n;
+    else if (sscanf(line, "ms %ld", &n) == 1) host_now_ms += n;
+    else if (sscanf(line, "key %d %d %c", &row, &col, &kind) == 3) host_key_event(row, col, kind == 'd');
+    else if (!strncmp(line, "frame", 5)) {
+      sscanf(line, "frame %ld", &n);
+      while (n-- > 0) frame();
+    } else if (sscanf(line, "dump %63s", arg) == 1) {
+      printf("dump %s %d %u ", arg, oled_is_on(), oled_get_brightness());
+      for (int i = 0; i < OLED_MATRIX_SIZE; i++) printf("%02x", oled_host_buffer[i]);
+      putchar('\n');
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * oled_mock.c
+ * SSD1306 128x32 en memoria con la misma lógica de bloques sucios que el driver
+ * I2C de QMK (16 bloques de 32 bytes): escribir un byte igual al que ya está no
+ * ensucia nada, y oled_render() manda por I2C solo los bloques sucios.
+ *
+ * Renderizar con la pantalla apagada la enciende, igual que en QMK.
+ *
+ * Bytes I2C contados por bloque (como oled_driver.c):
+ *   dirección + 0x00 + COLUMN_ADDR lo hi + PAGE_ADDR lo hi   =  8
+ *   dirección + 0x40 + 32 bytes de datos                     = 34
+ *
+ * La fuente es sintética (un glifo distinto por carácter): el glcdfont del
+ * teclado no está en este repo y los snapshots solo necesitan ser estables.
+ */
+#include "oled_driver.h"
+
+#define I2C_BLOCK_BYTES (8 + 2 + OLED_BLOCK_SIZE)
+#define I2C_CMD1_BYTES  3       /* dirección + 0x00 + comando */
+#define I2C_CMD2_BYTES  4       /* ídem con un argumento */
+
+uint8_t oled_host_buffer[OLED_MATRIX_SIZE];
+static uint16_t dirty;          /* bit i = bloque i */
+static uint16_t cursor;
+static bool active = true;
+static uint8_t brightness = 255;
+static uint32_t i2c_bytes;
+
+uint32_t oled_host_take_i2c_bytes(void) {
+  uint32_t n = i2c_bytes;
+  i2c_bytes = 0;
+  return n;
+}
+
+static void put(uint16_t index, uint8_t data) {
+  if (index >= OLED_MATRIX_SIZE || oled_host_buffer[index] == data) return;
+  oled_host_buffer[index] = data;
+  dirty |= 1u << (index / OLED_BLOCK_SIZE);
+}
+
+void oled_clear(void) {
+  memset(oled_host_buffer, 0, sizeof oled_host_buffer);
+  dirty = 0xFFFF;
+  cursor = 0;
+}
+
+void oled_render(void) {
+  if (!dirty) return;
+  oled_on();   /* como QMK: renderizar enciende la pantalla */
+  for (uint8_t b = 0; b < OLED_BLOCK_COUNT; b++)
+    if (dirty & (1u << b)) i2c_bytes += I2C_BLOCK_BYTES;
+  dirty = 0;
+}
+
+void oled_set_cursor(uint8_t col, uint8_t line) {
+  uint16_t index = line * OLED_DISPLAY_WIDTH + col * OLED_FONT_WIDTH;
+  cursor = index < OLED_MATRIX_SIZE ? index : 0;
+}
+
+/* ---------- Texto ---------- */
+static void glyph(uint8_t c, uint8_t out[OLED_FONT_WIDTH]) {
+  if (c == ' ') { memset(out, 0, OLED_FONT_WIDTH); return; }
+  out[0] = 0x7F;
+  out[1] = 0x41 | (c & 0x0F) << 1;
+  out[2] = 0x41 | (c >> 4) << 1;
+  out[3] = 0x41 | (((uint8_t)~c << 1) & 0x3E);
+  out[4] = 0x7F;
+  out[5] = 0x00;
+}
+
+static void advance_page(bool clear_rest) {
+  uint16_t next = (cursor / OLED_DISPLAY_WIDTH + 1) * OLED_DISPLAY_WIDTH;
+  if (clear_rest)
+    while (cursor < next && cursor < OLED_MATRIX_SIZE) put(cursor++, 0);
+  cursor = next < OLED_MATRIX_SIZE ? next : 0;
+}
+
+void oled_write_char(const char data, bool invert) {
+  if (data == '\n') { advance_page(true); return; }
+  if (data == '\r') { cursor -= cursor % OLED_DISPLAY_WIDTH; return; }
+  uint8_t g[OLED_FONT_WIDTH];
+  glyph((uint8_t)data, g);
+  for (uint8_t i = 0; i < OLED_FONT_WIDTH; i++) put(cursor + i, invert ? ~g[i] : g[i]);
+  cursor += OLED_FONT_WIDTH;
+  /* como QMK: si el próximo carácter no cabe en la línea, salta de página */
+  if (cursor % OLED_DISPLAY_WIDTH > OLED_DISPLAY_WIDTH - OLED_FONT_WIDTH) advance_page(false);
+}
+
+void oled_write(const char *data, bool invert) {
+  while (*data) oled_write_char(*data++, invert);
+}
+void oled_write_ln(const char *data, bool invert) {
+  oled_write(data, invert);
+  advance_page(true);
+}
+void oled_write_P(const char *data, bool invert) { oled_write(data, invert); }
+void oled_write_ln_P(const char *data, bool invert) { oled_write_ln(data, invert); }
+
+/* ---------- Crudo ---------- */
+void oled_write_raw_byte(const char data, uint16_t index) { put(index, (uint8_t)data); }
+void oled_write_raw_P(const char *data, uint16_t size) {
+  for (uint16_t i = 0; i < size && i < OLED_MATRIX_SIZE; i++) put(i, (uint8_t)data[i]);
+}
+
+/* ---------- Encendido y brillo (comandos sueltos) ---------- */
+bool oled_on(void) {
+  if (!active) { i2c_bytes += I2C_CMD1_BYTES; active = true; }
+  return active;
+}
+bool oled_off(void) {
+  if (active) { i2c_bytes += I2C_CMD1_BYTES; active = false; }
+  return !active;
+}
+bool oled_is_on(void) { return active; }
+uint8_t oled_set_brightness(uint8_t level) {
+  if (level != brightness) { i2c_bytes += I2C_CMD2_BYTES; brightness = level; }
+  return brightness;
+}
+uint8_t oled_get_brightness(void) { return brightness; }
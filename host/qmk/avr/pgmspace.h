@@ -0,0 +1,11 @@
+#pragma once
+/* En el host la "flash" es memoria normal */
+#include <stdint.h>
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p)  (*(const void *const *)(p))
+#define memcpy_P memcpy
+#define strlen_P strlen
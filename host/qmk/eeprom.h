@@ -0,0 +1,13 @@
+#pragma once
+/* EEPROM cruda de QMK (platforms/eeprom.h) para el host: 1 KB como el ATmega32u4 */
+#include <stdint.h>
+#include <stddef.h>
+
+#define E2END 1023
+#define EECONFIG_SIZE (37 + EECONFIG_USER_DATA_SIZE)   // eeconfig de QMK + bloque de usuario
+
+uint8_t eeprom_read_byte(const uint8_t *addr);
+void eeprom_write_byte(uint8_t *addr, uint8_t value);
+void eeprom_update_byte(uint8_t *addr, uint8_t value);
+void eeprom_read_block(void *buf, const void *addr, size_t len);
+void eeprom_update_block(const void *buf, void *addr, size_t len);
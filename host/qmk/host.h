@@ -0,0 +1,26 @@
+#pragma once
+/* Controles del entorno host (no existen en QMK): reloj simulado, mitad y capas. */
+#include "quantum.h"
+
+extern uint32_t host_now_ms;        /* lo avanza el arnés; timer_read() lo devuelve */
+extern bool host_master;            /* is_keyboard_master() */
+extern led_t host_leds;             /* host_keyboard_led_state() */
+extern uint32_t host_keys_sent;     /* tap/register_code* desde el keymap */
+extern uint16_t host_last_sent;     /* último keycode de register_code16() */
+extern uint32_t host_reports;       /* reportes HID de teclado enviados */
+extern uint32_t host_split_msgs;    /* transaction_rpc_send() a la esclava */
+extern uint32_t host_split_bytes;
+extern uint8_t host_eeprom_user[EECONFIG_USER_DATA_SIZE];
+extern uint8_t host_eeprom[E2END + 1];     /* eeprom_*(): fuera de eeconfig */
+extern uint32_t host_eeprom_writes; /* bytes de EEPROM que cambiaron */
+
+/* Como layer_state_set() de QMK: llama a layer_state_set_user() */
+void host_set_layer_state(layer_state_t state);
+
+/* Tecla de la matriz: resuelve la capa, corre process_record_user() y, si devuelve
+   true, la acción básica (MO, TG, mods, Caps Lock del host) y post_process_record_user() */
+void host_key_event(uint8_t row, uint8_t col, bool pressed);
+
+/* Cada register_code()/unregister_code() con los mods vigentes (weak: el arnés lo redefine) */
+void host_on_key(uint8_t kc, uint8_t mods, bool pressed);
+void keyboard_post_init_user(void);
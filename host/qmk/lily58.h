@@ -0,0 +1 @@
+#include "quantum.h"
@@ -0,0 +1,34 @@
+#pragma once
+/* OLED SSD1306 128x32 emulado (host/oled_mock.c): mismo API que QMK y un
+   contador de bytes que el driver real empujaría por I2C. */
+#include "quantum.h"
+
+#define OLED_DISPLAY_WIDTH  128
+#define OLED_DISPLAY_HEIGHT 32
+#define OLED_MATRIX_SIZE    (OLED_DISPLAY_WIDTH * OLED_DISPLAY_HEIGHT / 8)
+#define OLED_BLOCK_SIZE     32           /* 16 bloques sucios, como QMK para 128x32 */
+#define OLED_BLOCK_COUNT    (OLED_MATRIX_SIZE / OLED_BLOCK_SIZE)
+#define OLED_FONT_WIDTH     6
+#define OLED_FONT_HEIGHT    8
+
+typedef enum { OLED_ROTATION_0 = 0, OLED_ROTATION_90 = 1, OLED_ROTATION_180 = 2, OLED_ROTATION_270 = 3 } oled_rotation_t;
+
+void oled_clear(void);
+void oled_render(void);
+void oled_set_cursor(uint8_t col, uint8_t line);
+void oled_write_char(const char data, bool invert);
+void oled_write(const char *data, bool invert);
+void oled_write_ln(const char *data, bool invert);
+void oled_write_P(const char *data, bool invert);
+void oled_write_ln_P(const char *data, bool invert);
+void oled_write_raw_byte(const char data, uint16_t index);
+void oled_write_raw_P(const char *data, uint16_t size);
+bool oled_on(void);
+bool oled_off(void);
+bool oled_is_on(void);
+uint8_t oled_set_brightness(uint8_t level);
+uint8_t oled_get_brightness(void);
+
+/* Solo host */
+extern uint8_t oled_host_buffer[OLED_MATRIX_SIZE];
+uint32_t oled_host_take_i2c_bytes(void);
@@ -0,0 +1,14 @@
+#pragma once
+/* quantum/os_detection.h */
+#include <stdbool.h>
+
+typedef enum {
+  OS_UNSURE,
+  OS_LINUX,
+  OS_WINDOWS,
+  OS_MACOS,
+  OS_IOS,
+} os_variant_t;
+
+os_variant_t detected_host_os(void);
+bool process_detected_host_os_user(os_variant_t detected_os);
@@ -0,0 +1,146 @@
+#pragma once
+/* ──────────────────────────────────────────────────────────────
+ *  QMK mínimo para compilar el keymap en el host (oled_emulator.py).
+ *  Solo declara lo que usa el keymap; valores de keycodes iguales
+ *  a QMK para los básicos (HID) y los rangos cuánticos.
+ * ────────────────────────────────────────────────────────────*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "avr/pgmspace.h"
+#include "config.h"
+#include "eeprom.h"
+
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 6
+
+enum host_keycodes {
+  KC_NO = 0x00, KC_TRNS = 0x01,
+  KC_A = 0x04, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M,
+  KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z,
+  KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0,
+  KC_ENT, KC_ESC, KC_BSPC, KC_TAB, KC_SPC, KC_MINS, KC_EQL, KC_LBRC, KC_RBRC, KC_BSLS,
+  KC_NUHS, KC_SCLN, KC_QUOT, KC_GRV, KC_COMM, KC_DOT, KC_SLSH, KC_CAPS,
+  KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12,
+  KC_HOME = 0x4A, KC_PGUP, KC_DEL, KC_END, KC_PGDN, KC_RGHT, KC_LEFT, KC_DOWN, KC_UP,
+  KC_KP_ASTERISK = 0x55, KC_KP_PLUS = 0x57, KC_NUBS = 0x64,
+  KC_MUTE = 0xA8, KC_VOLU, KC_VOLD, KC_MNXT, KC_MPRV, KC_MSTP, KC_MPLY,
+  KC_LCTL = 0xE0, KC_LSFT, KC_LALT, KC_LGUI, KC_RCTL, KC_RSFT, KC_RALT, KC_RGUI,
+  QK_MOMENTARY = 0x5220, QK_TOGGLE_LAYER = 0x5260,
+  SAFE_RANGE = 0x7E40,
+};
+#define KC_TRANSPARENT KC_TRNS
+#define _______ KC_TRNS
+#define XXXXXXX KC_NO
+
+#define QK_LCTL 0x0100
+#define QK_LSFT 0x0200
+#define QK_LALT 0x0400
+#define QK_LGUI 0x0800
+#define QK_RCTL 0x1100
+#define QK_RSFT 0x1200
+#define QK_RALT 0x1400
+#define C(kc)    (QK_LCTL | (kc))
+#define S(kc)    (QK_LSFT | (kc))
+#define LSFT(kc) S(kc)
+#define LGUI(kc) (QK_LGUI | (kc))
+#define RALT(kc) (QK_RALT | (kc))
+#define MO(l)    (QK_MOMENTARY | (l))
+#define TG(l)    (QK_TOGGLE_LAYER | (l))
+#define KC_EXLM  S(KC_1)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc) & 0xFF)
+#define QK_MODS_GET_MODS(kc)          (((kc) >> 8) & 0x1F)
+#define QK_BASIC_MAX 0x00FF
+#define QK_MODS_MAX  0x1FFF
+#define IS_MODIFIER_KEYCODE(kc) ((kc) >= KC_LCTL && (kc) <= KC_RGUI)
+#define IS_QK_MOMENTARY(kc)     ((kc) >= QK_MOMENTARY && (kc) <= QK_MOMENTARY + 0x1F)
+#define IS_QK_TOGGLE_LAYER(kc)  ((kc) >= QK_TOGGLE_LAYER && (kc) <= QK_TOGGLE_LAYER + 0x1F)
+
+#define MOD_BIT(kc)    (1 << ((kc) & 0x07))
+#define MOD_MASK_CTRL  (MOD_BIT(KC_LCTL) | MOD_BIT(KC_RCTL))
+#define MOD_MASK_SHIFT (MOD_BIT(KC_LSFT) | MOD_BIT(KC_RSFT))
+#define MOD_MASK_ALT   (MOD_BIT(KC_LALT) | MOD_BIT(KC_RALT))
+#define MOD_MASK_GUI   (MOD_BIT(KC_LGUI) | MOD_BIT(KC_RGUI))
+
+typedef uint32_t layer_state_t;
+typedef struct { uint8_t col, row; } keypos_t;
+typedef struct { keypos_t key; bool pressed; uint16_t time; } keyevent_t;
+typedef struct { uint8_t count; bool interrupted; } tap_t;
+typedef struct { keyevent_t event; tap_t tap; } keyrecord_t;
+typedef union {
+  uint8_t raw;
+  struct { bool num_lock : 1, caps_lock : 1, scroll_lock : 1, compose : 1, kana : 1; };
+} led_t;
+
+extern layer_state_t layer_state, default_layer_state;
+bool layer_state_cmp(layer_state_t state, uint8_t layer);
+bool layer_state_is(uint8_t layer);
+uint8_t get_highest_layer(layer_state_t state);
+uint8_t read_source_layers_cache(keypos_t key);   /* capa de la que salió la tecla apretada */
+layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_t layer2, uint8_t layer3);
+
+uint8_t get_mods(void);
+uint8_t get_oneshot_mods(void);
+uint8_t get_weak_mods(void);
+void set_mods(uint8_t mods);
+void add_mods(uint8_t mods);
+void del_mods(uint8_t mods);
+void clear_mods(void);
+void set_oneshot_mods(uint8_t mods);
+void clear_oneshot_mods(void);
+void add_weak_mods(uint8_t mods);
+void del_weak_mods(uint8_t mods);
+void set_weak_mods(uint8_t mods);
+void clear_weak_mods(void);
+void send_keyboard_report(void);
+
+void register_code(uint8_t kc);
+void unregister_code(uint8_t kc);
+void tap_code(uint8_t kc);
+void register_code16(uint16_t kc);
+void unregister_code16(uint16_t kc);
+void tap_code16(uint16_t kc);
+void wait_ms(uint16_t ms);
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+uint16_t sync_timer_read(void);
+uint32_t sync_timer_read32(void);
+uint32_t last_input_activity_elapsed(void);
+void housekeeping_task_user(void);
+void suspend_wakeup_init_user(void);
+void matrix_scan_user(void);
+const char *get_u16_str(uint16_t curr_num, char curr_pad);
+
+/* bloque de usuario de la EEPROM (EECONFIG_USER_DATA_SIZE) */
+void eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length);
+void eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length);
+
+led_t host_keyboard_led_state(void);
+bool is_keyboard_master(void);
+uint16_t keycode_at_keymap_location(uint8_t layer, uint8_t row, uint8_t col);
+
+#ifdef RGBLIGHT_ENABLE
+#  include "rgblight.h"
+#endif
+#ifdef OS_DETECTION_ENABLE
+#  include "os_detection.h"
+#endif
+
+/* Lily58 rev1: la mitad derecha está espejada en la matriz */
+#define LAYOUT( \
+  L00, L01, L02, L03, L04, L05,           R00, R01, R02, R03, R04, R05, \
+  L10, L11, L12, L13, L14, L15,           R10, R11, R12, R13, R14, R15, \
+  L20, L21, L22, L23, L24, L25,           R20, R21, R22, R23, R24, R25, \
+  L30, L31, L32, L33, L34, L35, L45, R40, R30, R31, R32, R33, R34, R35, \
+                 L41, L42, L43, L44, R41, R42, R43, R44 ) \
+  { \
+    { L00, L01, L02, L03, L04, L05 }, { L10, L11, L12, L13, L14, L15 }, \
+    { L20, L21, L22, L23, L24, L25 }, { L30, L31, L32, L33, L34, L35 }, \
+    { KC_NO, L41, L42, L43, L44, L45 }, \
+    { R05, R04, R03, R02, R01, R00 }, { R15, R14, R13, R12, R11, R10 }, \
+    { R25, R24, R23, R22, R21, R20 }, { R35, R34, R33, R32, R31, R30 }, \
+    { KC_NO, R44, R43, R42, R41, R40 } \
+  }
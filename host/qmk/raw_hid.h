@@ -0,0 +1,8 @@
+#pragma once
+/* quantum/raw_hid.h: en el host raw_hid_send() deja la respuesta en host_raw_hid_reply */
+#include <stdint.h>
+
+void raw_hid_receive(uint8_t *data, uint8_t length);
+void raw_hid_send(uint8_t *data, uint8_t length);
+
+extern uint8_t host_raw_hid_reply[32];
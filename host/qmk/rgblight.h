@@ -0,0 +1,43 @@
+#pragma once
+/* rgblight modelado en el host (host/rgblight_mock.c): mismo API que QMK para lo que
+   usa el keymap, más contadores de escrituras WS2812 y sincronizaciones del split. */
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HSV_WHITE   0,   0, 255
+#define HSV_RED     0, 255, 255
+#define HSV_YELLOW 43, 255, 255
+#define HSV_GREEN  85, 255, 255
+#define HSV_CYAN  128, 255, 255
+#define HSV_BLUE  170, 255, 255
+#define HSV_MAGENTA 213, 255, 255
+
+enum rgblight_modes {
+  RGBLIGHT_MODE_STATIC_LIGHT = 1,
+  RGBLIGHT_MODE_BREATHING,          /* 2..5: intervalos 30/20/10/5 ms */
+  RGBLIGHT_MODE_BREATHING_end = RGBLIGHT_MODE_BREATHING + 3,
+};
+
+void rgblight_enable_noeeprom(void);
+void rgblight_disable_noeeprom(void);
+bool rgblight_is_enabled(void);
+void rgblight_mode_noeeprom(uint8_t mode);
+uint8_t rgblight_get_mode(void);
+void rgblight_set_speed(uint8_t speed);
+uint8_t rgblight_get_speed(void);
+void rgblight_sethsv_noeeprom(uint8_t hue, uint8_t sat, uint8_t val);
+void rgblight_setrgb(uint8_t r, uint8_t g, uint8_t b);
+uint8_t rgblight_get_hue(void);
+uint8_t rgblight_get_sat(void);
+uint8_t rgblight_get_val(void);
+void rgblight_task(void);
+
+/* Solo host */
+typedef struct {
+  uint32_t api_calls;      /* llamadas rgblight_* desde el keymap */
+  uint32_t frames;         /* escrituras WS2812 (rgblight_set) en la maestra */
+  uint32_t redundant;      /* frames idénticos al anterior */
+  uint32_t restarts;       /* reinicios de la animación */
+  uint32_t syncs;          /* mensajes RGBLIGHT_SPLIT a la esclava */
+} rgblight_host_stats_t;
+extern rgblight_host_stats_t rgblight_host_stats;
@@ -0,0 +1,19 @@
+#pragma once
+/* quantum/split_common/transactions.h (solo las RPC del usuario) */
+#include "quantum.h"
+
+enum serial_transaction_id {
+  HOST_TRANSACTIONS_CORE = 0,
+#ifdef SPLIT_TRANSACTION_IDS_USER
+  SPLIT_TRANSACTION_IDS_USER,
+#endif
+  NUM_TOTAL_TRANSACTIONS
+};
+
+typedef void (*slave_callback_t)(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer,
+                                 uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
+
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buffer_size,
+                          const void *initiator2target_buffer);
+bool is_transport_connected(void);
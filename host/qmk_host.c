@@ -0,0 +1,194 @@
+/*
+ * qmk_host.c
+ * Núcleo mínimo de QMK para el host: capas, mods, reloj y envío de teclas.
+ * Solo guarda estado; lo que ve el usuario lo dibuja oled_mock.c.
+ */
+#include "host.h"
+#include "transactions.h"
+#include "raw_hid.h"
+
+uint32_t host_now_ms;
+bool host_master = true;
+led_t host_leds;
+uint32_t host_keys_sent;
+uint16_t host_last_sent;
+uint32_t host_reports;
+uint32_t host_split_msgs, host_split_bytes;
+
+layer_state_t layer_state, default_layer_state = 1;
+static uint8_t mods, oneshot_mods, weak_mods;
+
+/* ---------- Capas ---------- */
+__attribute__((weak)) layer_state_t layer_state_set_user(layer_state_t state) { return state; }
+
+void host_set_layer_state(layer_state_t state) { layer_state = layer_state_set_user(state); }
+
+bool layer_state_cmp(layer_state_t state, uint8_t layer) {
+  if (!state) return layer == 0;
+  return (state & ((layer_state_t)1 << layer)) != 0;
+}
+bool layer_state_is(uint8_t layer) { return layer_state_cmp(layer_state, layer); }
+uint8_t get_highest_layer(layer_state_t state) {
+  uint8_t top = 0;
+  for (uint8_t i = 0; i < 32; i++)
+    if (state & ((layer_state_t)1 << i)) top = i;
+  return top;
+}
+layer_state_t update_tri_layer_state(layer_state_t state, uint8_t layer1, uint8_t layer2, uint8_t layer3) {
+  layer_state_t mask12 = ((layer_state_t)1 << layer1) | ((layer_state_t)1 << layer2);
+  layer_state_t mask3 = (layer_state_t)1 << layer3;
+  return (state & mask12) == mask12 ? (state | mask3) : (state & ~mask3);
+}
+
+/* ---------- Mods ---------- */
+uint8_t get_mods(void) { return mods; }
+uint8_t get_oneshot_mods(void) { return oneshot_mods; }
+uint8_t get_weak_mods(void) { return weak_mods; }
+void set_mods(uint8_t m) { mods = m; }
+void add_mods(uint8_t m) { mods |= m; }
+void del_mods(uint8_t m) { mods &= ~m; }
+void clear_mods(void) { mods = 0; }
+void set_oneshot_mods(uint8_t m) { oneshot_mods = m; }
+void clear_oneshot_mods(void) { oneshot_mods = 0; }
+void add_weak_mods(uint8_t m) { weak_mods |= m; }
+void del_weak_mods(uint8_t m) { weak_mods &= ~m; }
+void set_weak_mods(uint8_t m) { weak_mods = m; }
+void clear_weak_mods(void) { weak_mods = 0; }
+void send_keyboard_report(void) { host_reports++; }
+
+/* ---------- Teclas: se cuentan teclas y reportes HID como en action.c ---------- */
+__attribute__((weak)) void host_on_key(uint8_t kc, uint8_t mods, bool pressed) {}
+void register_code(uint8_t kc) { host_keys_sent++; host_reports++; host_on_key(kc, mods | weak_mods, true); }
+void unregister_code(uint8_t kc) { host_reports++; host_on_key(kc, mods | weak_mods, false); }
+void tap_code(uint8_t kc) { register_code(kc); unregister_code(kc); }
+/* mods de 5 bits del keycode (bit 4 = derechos) a los 8 bits del reporte */
+static uint8_t mods_of(uint16_t kc) {
+  uint8_t m = QK_MODS_GET_MODS(kc);
+  return m & 0x10 ? (m & 0x0F) << 4 : m;
+}
+/* con mods: register_weak_mods() y register_code(), un reporte cada uno */
+void register_code16(uint16_t kc) {
+  host_last_sent = kc;
+  host_keys_sent++;
+  host_reports += QK_MODS_GET_MODS(kc) ? 2 : 1;
+  host_on_key(QK_MODS_GET_BASIC_KEYCODE(kc), mods | weak_mods | mods_of(kc), true);
+}
+void unregister_code16(uint16_t kc) {
+  host_reports += QK_MODS_GET_MODS(kc) ? 2 : 1;
+  host_on_key(QK_MODS_GET_BASIC_KEYCODE(kc), mods | weak_mods, false);
+}
+void tap_code16(uint16_t kc) { register_code16(kc); unregister_code16(kc); }
+void wait_ms(uint16_t ms) { host_now_ms += ms; }
+
+/* ---------- Acciones de teclas ---------- */
+__attribute__((weak)) bool process_record_user(uint16_t keycode, keyrecord_t *record) { return true; }
+__attribute__((weak)) void post_process_record_user(uint16_t keycode, keyrecord_t *record) {}
+__attribute__((weak)) bool led_update_user(led_t led_state) { return true; }
+__attribute__((weak)) void keyboard_post_init_user(void) {}
+
+__attribute__((weak)) void housekeeping_task_user(void) {}
+__attribute__((weak)) void matrix_scan_user(void) {}
+
+/* quantum.c: número de 5 caracteres alineado a la derecha */
+const char *get_u16_str(uint16_t curr_num, char curr_pad) {
+  static char buf[6];
+  buf[5] = '\0';
+  for (int i = 4; i >= 0; i--) {
+    buf[i] = (i == 4 || curr_num) ? '0' + curr_num % 10 : curr_pad;
+    curr_num /= 10;
+  }
+  return buf;
+}
+
+static uint32_t last_activity_ms;
+static uint8_t pressed_layer[MATRIX_ROWS][MATRIX_COLS];  /* como el source layers cache */
+
+uint8_t read_source_layers_cache(keypos_t key) {
+  return key.row < MATRIX_ROWS && key.col < MATRIX_COLS ? pressed_layer[key.row][key.col] : 0;
+}
+
+static uint8_t layer_for_key(uint8_t row, uint8_t col) {
+  layer_state_t layers = layer_state | default_layer_state;
+  for (int8_t l = 31; l >= 0; l--)
+    if ((layers & ((layer_state_t)1 << l)) && keycode_at_keymap_location(l, row, col) != KC_TRNS) return l;
+  return 0;
+}
+
+void host_key_event(uint8_t row, uint8_t col, bool pressed) {
+  if (row >= MATRIX_ROWS || col >= MATRIX_COLS) return;
+  last_activity_ms = host_now_ms;
+  if (pressed) pressed_layer[row][col] = layer_for_key(row, col);
+  uint16_t kc = keycode_at_keymap_location(pressed_layer[row][col], row, col);
+  keyrecord_t record = { .event = { .key = { .col = col, .row = row }, .pressed = pressed,
+                                    .time = (uint16_t)host_now_ms } };
+  if (!process_record_user(kc, &record)) return;
+
+  if ((kc & 0xFFE0) == QK_MOMENTARY) {
+    layer_state_t bit = (layer_state_t)1 << (kc & 0x1F);
+    host_set_layer_state(pressed ? layer_state | bit : layer_state & ~bit);
+  } else if ((kc & 0xFFE0) == QK_TOGGLE_LAYER) {
+    if (pressed) host_set_layer_state(layer_state ^ ((layer_state_t)1 << (kc & 0x1F)));
+  } else if (kc >= KC_LCTL && kc <= KC_RGUI) {
+    if (pressed) add_mods(MOD_BIT(kc)); else del_mods(MOD_BIT(kc));
+  } else if (kc == KC_CAPS) {
+    /* el host responde al toque con el LED de Caps Lock */
+    if (pressed) { host_leds.caps_lock = !host_leds.caps_lock; led_update_user(host_leds); }
+  } else if (kc != KC_NO) {
+    if (pressed) register_code16(kc); else if (kc <= QK_MODS_MAX) unregister_code16(kc);
+  }
+  post_process_record_user(kc, &record);
+}
+
+/* ---------- Reloj ---------- */
+uint16_t timer_read(void) { return (uint16_t)host_now_ms; }
+uint32_t timer_read32(void) { return host_now_ms; }
+uint16_t timer_elapsed(uint16_t last) { return (uint16_t)(timer_read() - last); }
+uint32_t timer_elapsed32(uint32_t last) { return host_now_ms - last; }
+uint16_t sync_timer_read(void) { return timer_read(); }
+uint32_t sync_timer_read32(void) { return timer_read32(); }
+uint32_t last_input_activity_elapsed(void) { return host_now_ms - last_activity_ms; }
+
+/* ---------- Split: la esclava no se simula, solo se cuentan los mensajes ---------- */
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback) {}
+bool transaction_rpc_send(int8_t transaction_id, uint8_t len, const void *data) {
+  host_split_msgs++;
+  host_split_bytes += len;
+  return true;
+}
+bool is_transport_connected(void) { return true; }
+
+/* ---------- EEPROM: borrada (0xFF) al arrancar; se cuentan los bytes que cambian ---------- */
+uint8_t host_eeprom_user[EECONFIG_USER_DATA_SIZE] = { [0 ... EECONFIG_USER_DATA_SIZE - 1] = 0xFF };
+uint32_t host_eeprom_writes;
+void eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length) {
+  memcpy(data, host_eeprom_user + offset, length);
+}
+void eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length) {
+  for (uint32_t i = 0; i < length; i++) {
+    uint8_t b = ((const uint8_t *)data)[i];
+    if (host_eeprom_user[offset + i] != b) { host_eeprom_user[offset + i] = b; host_eeprom_writes++; }
+  }
+}
+
+uint8_t host_eeprom[E2END + 1] = { [0 ... E2END] = 0xFF };
+uint8_t eeprom_read_byte(const uint8_t *addr) { return host_eeprom[(uintptr_t)addr]; }
+void eeprom_write_byte(uint8_t *addr, uint8_t value) { host_eeprom[(uintptr_t)addr] = value; host_eeprom_writes++; }
+void eeprom_update_byte(uint8_t *addr, uint8_t value) {
+  if (eeprom_read_byte(addr) != value) eeprom_write_byte(addr, value);
+}
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+  memcpy(buf, host_eeprom + (uintptr_t)addr, len);
+}
+void eeprom_update_block(const void *buf, void *addr, size_t len) {
+  for (size_t i = 0; i < len; i++) eeprom_update_byte((uint8_t *)addr + i, ((const uint8_t *)buf)[i]);
+}
+
+/* ---------- Raw HID: la respuesta queda para que la lea el arnés ---------- */
+uint8_t host_raw_hid_reply[32];
+void raw_hid_send(uint8_t *data, uint8_t length) { memcpy(host_raw_hid_reply, data, length); }
+
+led_t host_keyboard_led_state(void) { return host_leds; }
+bool is_keyboard_master(void) { return host_master; }
+
+/* lib/logo_reader.c del teclado (no está en este repo) */
+const char *read_logo(void) { return ""; }
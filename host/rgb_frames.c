@@ -0,0 +1,76 @@
+/*
+ * rgb_frames.c
+ * Arnés del emulador de RGB: corre el keymap con rgblight_mock.c en tiempo simulado
+ * (un scan por ms) e inyecta eventos de un script "<ms> d|u <fila> <col>" (el mismo
+ * formato de sim/workloads/). Imprime una línea JSON con los contadores.
+ *
+ *   rgb_frames --script sim/workloads/layers.txt --ms 10000
+ *
+ * Lo compila y maneja rgb_emulator.py.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "host.h"
+
+#define MAX_EVENTS 4096
+
+typedef struct { uint32_t ms; int down, row, col; } event_t;
+
+static event_t events[MAX_EVENTS];
+static int nevents;
+
+static void load_script(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) { perror(path); exit(1); }
+  char line[256];
+  while (fgets(line, sizeof line, f) && nevents < MAX_EVENTS) {
+    char *hash = strchr(line, '#');
+    if (hash) *hash = 0;
+    event_t e; char kind;
+    if (sscanf(line, "%u %c %d %d", &e.ms, &kind, &e.row, &e.col) != 4) continue;
+    e.down = (kind == 'd');
+    events[nevents++] = e;
+  }
+  fclose(f);
+}
+
+int main(int argc, char **argv) {
+  uint32_t run_ms = 10000;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--ms") && i + 1 < argc) run_ms = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--script") && i + 1 < argc) load_script(argv[++i]);
+  }
+
+  keyboard_post_init_user();
+  uint32_t boot_calls = rgblight_host_stats.api_calls;
+  uint32_t presses = 0, key_calls = 0, key_max = 0, idle_frames = 0;
+  uint32_t last_event_ms = 0;
+  int next = 0;
+
+  for (host_now_ms = 0; host_now_ms < run_ms; host_now_ms++) {
+    while (next < nevents && events[next].ms <= host_now_ms) {
+      event_t *e = &events[next++];
+      uint32_t before = rgblight_host_stats.api_calls;
+      host_key_event(e->row, e->col, e->down);
+      uint32_t d = rgblight_host_stats.api_calls - before;
+      key_calls += d;
+      if (e->down) presses++;
+      if (d > key_max) key_max = d;
+      last_event_ms = host_now_ms;
+    }
+    uint32_t frames = rgblight_host_stats.frames;
+    matrix_scan_user();
+    housekeeping_task_user();
+    rgblight_task();
+    /* frames con el teclado quieto (> 1 s sin eventos) */
+    if (host_now_ms - last_event_ms > 1000) idle_frames += rgblight_host_stats.frames - frames;
+  }
+
+  rgblight_host_stats_t *s = &rgblight_host_stats;
+  printf("{\"ms\": %u, \"frames\": %u, \"redundant\": %u, \"idle_frames\": %u, \"restarts\": %u, "
+         "\"syncs\": %u, \"split_msgs\": %u, \"boot_calls\": %u, \"presses\": %u, \"key_calls\": %u, \"key_calls_max\": %u}\n",
+         run_ms, s->frames, s->redundant, idle_frames, s->restarts, s->syncs, host_split_msgs, boot_calls, presses, key_calls,
+         key_max);
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * rgblight_mock.c
+ * Modelo en el host de rgblight de QMK para el modo BREATHING y la luz estática:
+ *  - rgblight_mode_noeeprom() siempre reinicia la animación (pos = 0, frame inmediato)
+ *    y marca el modo como cambiado para RGBLIGHT_SPLIT, aunque el modo sea el mismo.
+ *  - rgblight_sethsv_noeeprom() en BREATHING solo guarda hue/sat (el val lo pone la
+ *    animación) y marca HSV como cambiado.
+ *  - rgblight_task() corre el efecto cada 30/20/10/5 ms según el modo; cada paso
+ *    escribe los LEDs de esta mitad (rgblight_set -> WS2812).
+ * La curva es la de rgblight_effect_breathing() con RGBLIGHT_LIMIT_VAL aplicado.
+ */
+#include <math.h>
+#include "quantum.h"
+
+#ifndef RGBLIGHT_LIMIT_VAL
+#  define RGBLIGHT_LIMIT_VAL 255
+#endif
+#ifndef RGBLIGHT_EFFECT_BREATHE_CENTER
+#  define RGBLIGHT_EFFECT_BREATHE_CENTER 1.85
+#endif
+#ifndef RGBLIGHT_EFFECT_BREATHE_MAX
+#  define RGBLIGHT_EFFECT_BREATHE_MAX 255
+#endif
+
+rgblight_host_stats_t rgblight_host_stats;
+
+static const uint8_t breathing_intervals[] = { 30, 20, 10, 5 };
+
+static struct {
+  bool enable;
+  uint8_t mode, hue, sat, val, speed;
+} config = { .mode = RGBLIGHT_MODE_STATIC_LIGHT, .sat = 255, .val = RGBLIGHT_LIMIT_VAL };
+
+static struct {
+  bool restart, changed;
+  uint8_t pos;
+  uint16_t last_timer;
+} anim;
+
+static uint8_t last_rgb[3];
+static bool written;
+
+static bool is_breathing(uint8_t mode) {
+  return mode >= RGBLIGHT_MODE_BREATHING && mode <= RGBLIGHT_MODE_BREATHING_end;
+}
+
+/* hsv_to_rgb() de QMK (quantum/color.c) */
+static void hsv_to_rgb(uint8_t h, uint8_t s, uint8_t v, uint8_t rgb[3]) {
+  if (s == 0) { rgb[0] = rgb[1] = rgb[2] = v; return; }
+  uint8_t region = h * 6 / 255;
+  uint8_t rem = (h * 2 - region * 85) * 3;
+  uint8_t p = (v * (255 - s)) >> 8;
+  uint8_t q = (v * (255 - ((s * rem) >> 8))) >> 8;
+  uint8_t t = (v * (255 - ((s * (255 - rem)) >> 8))) >> 8;
+  switch (region) {
+    case 6:
+    case 0:  rgb[0] = v; rgb[1] = t; rgb[2] = p; break;
+    case 1:  rgb[0] = q; rgb[1] = v; rgb[2] = p; break;
+    case 2:  rgb[0] = p; rgb[1] = v; rgb[2] = t; break;
+    case 3:  rgb[0] = p; rgb[1] = q; rgb[2] = v; break;
+    case 4:  rgb[0] = t; rgb[1] = p; rgb[2] = v; break;
+    default: rgb[0] = v; rgb[1] = p; rgb[2] = q; break;
+  }
+}
+
+/* rgblight_setrgb() + rgblight_set(): todos los LEDs del mismo color */
+static void write_rgb(const uint8_t rgb[3]) {
+  if (written && !memcmp(rgb, last_rgb, 3)) rgblight_host_stats.redundant++;
+  memcpy(last_rgb, rgb, 3);
+  written = true;
+  rgblight_host_stats.frames++;
+}
+
+static void write_leds(uint8_t h, uint8_t s, uint8_t v) {
+  uint8_t rgb[3];
+  hsv_to_rgb(h, s, v > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : v, rgb);
+  write_rgb(rgb);
+}
+
+static void sethsv_helper(uint8_t h, uint8_t s, uint8_t v) {
+  if (!config.enable) return;
+  if (is_breathing(config.mode)) v = config.val;   /* el val lo maneja la animación */
+  else write_leds(h, s, v);
+  config.hue = h; config.sat = s; config.val = v;
+  anim.changed = true;
+}
+
+static void mode_helper(uint8_t mode) {
+  config.mode = mode;
+  anim.changed = true;
+  if (is_breathing(mode)) anim.restart = true;
+  sethsv_helper(config.hue, config.sat, config.val);
+}
+
+/* ---------- API ---------- */
+void rgblight_enable_noeeprom(void) {
+  rgblight_host_stats.api_calls++;
+  config.enable = true;
+  mode_helper(config.mode);
+}
+void rgblight_disable_noeeprom(void) {
+  rgblight_host_stats.api_calls++;
+  config.enable = false;
+  anim.changed = true;
+  write_leds(0, 0, 0);
+}
+bool rgblight_is_enabled(void) { return config.enable; }
+
+void rgblight_mode_noeeprom(uint8_t mode) {
+  rgblight_host_stats.api_calls++;
+  mode_helper(mode);
+}
+uint8_t rgblight_get_mode(void) { return config.mode; }
+
+void rgblight_set_speed(uint8_t speed) {
+  rgblight_host_stats.api_calls++;
+  config.speed = speed;
+}
+uint8_t rgblight_get_speed(void) { return config.speed; }
+
+void rgblight_sethsv_noeeprom(uint8_t hue, uint8_t sat, uint8_t val) {
+  rgblight_host_stats.api_calls++;
+  sethsv_helper(hue, sat, val);
+}
+void rgblight_setrgb(uint8_t r, uint8_t g, uint8_t b) {
+  rgblight_host_stats.api_calls++;
+  if (!config.enable) return;
+  const uint8_t rgb[3] = { r, g, b };
+  write_rgb(rgb);
+}
+uint8_t rgblight_get_hue(void) { return config.hue; }
+uint8_t rgblight_get_sat(void) { return config.sat; }
+uint8_t rgblight_get_val(void) { return config.val; }
+
+/* ---------- Animación (housekeeping de cada scan) ---------- */
+static uint8_t breathe_val(uint8_t pos) {
+  return (exp(sin((pos / 255.0) * M_PI)) - RGBLIGHT_EFFECT_BREATHE_CENTER / M_E) *
+         (RGBLIGHT_EFFECT_BREATHE_MAX / (M_E - 1 / M_E));
+}
+
+void rgblight_task(void) {
+  /* RGBLIGHT_SPLIT: un mensaje por scan si cambió la config */
+  if (anim.changed) { rgblight_host_stats.syncs++; anim.changed = false; }
+  if (!config.enable || !is_breathing(config.mode)) return;
+
+  uint8_t interval = breathing_intervals[config.mode - RGBLIGHT_MODE_BREATHING];
+  if (anim.restart) {
+    anim.restart = false;
+    anim.last_timer = timer_read() - interval - 1;
+    anim.pos = 0;
+    rgblight_host_stats.restarts++;
+  }
+  if (timer_elapsed(anim.last_timer) >= interval) {
+    anim.last_timer += interval;
+    write_leds(config.hue, config.sat, breathe_val(anim.pos));
+    anim.pos++;
+  }
+}
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+hotpath_prof.py
+Lee por Raw HID las estadísticas del perfilador del firmware (keymaps/hotpath_prof.c,
+HOTPATH_PROF = yes, apagado por defecto en rules.mk): por sonda, llamadas, min/prom/máx en µs e histograma log2.
+
+Sondas (enum prof_probe):
+  loop             tiempo entre dos housekeeping_task_user(): una vuelta de keyboard_task()
+  process_record   process_record_user()
+  oled_task        oled_task_user()
+  lighting         apply_layer_lighting()
+
+En AVR la resolución es un tick de Timer0 (4 µs a 16 MHz); los contadores viven en RAM y
+el firmware no imprime nada: solo responde cuando se le pregunta.
+
+Requisitos: hidapi (pip install hidapi).
+Uso (firmware compilado con qmk compile -kb lily58 -km bodegafresh_latam -e HOTPATH_PROF=yes):
+  python3 hotpath_prof.py                  # tabla por sonda
+  python3 hotpath_prof.py --hist           # más el histograma de cada sonda
+  python3 hotpath_prof.py --reset          # pone los contadores en cero
+  python3 hotpath_prof.py --json
+"""
+
+import sys, json, struct, argparse
+
+from raw_hid import (RawHid, RawHidError, CMD_PROF_INFO, CMD_PROF_READ, CMD_PROF_RESET,
+                     LILY58_VID, LILY58_PID, parse_int)
+
+PROBES = ["loop", "process_record", "oled_task", "lighting"]
+
+def bucket_label(k, last):
+    lo = 0 if k == 0 else 4 << k
+    return f">={lo}" if k == last else f"{lo}-{(4 << (k + 1)) - 1}"
+
+def read_all(kb):
+    probes, buckets, tick_us = struct.unpack_from("<BBH", kb.call(CMD_PROF_INFO))
+    out = {"tick_us": tick_us, "probes": []}
+    for p in range(probes):
+        summary = kb.call(CMD_PROF_READ, p, 0)
+        n, total, lo, hi = struct.unpack_from("<IIHH", summary, 2)
+        hist = list(struct.unpack_from(f"<{buckets}H", kb.call(CMD_PROF_READ, p, 1), 2))
+        out["probes"].append({
+            "name": PROBES[p] if p < len(PROBES) else f"probe{p}",
+            "n": n, "min_us": lo if n else 0, "avg_us": total / n if n else 0.0, "max_us": hi,
+            "hist": hist,
+        })
+    return out
+
+def print_table(stats, show_hist):
+    print(f"resolución: {stats['tick_us']} µs")
+    print(f"{'sonda':<16} {'llamadas':>10} {'min µs':>8} {'prom µs':>9} {'máx µs':>8}")
+    for s in stats["probes"]:
+        print(f"{s['name']:<16} {s['n']:>10} {s['min_us']:>8} {s['avg_us']:>9.1f} {s['max_us']:>8}")
+    if not show_hist:
+        return
+    for s in stats["probes"]:
+        total = sum(s["hist"]) or 1
+        print(f"\n{s['name']}")
+        for k, c in enumerate(s["hist"]):
+            if c:
+                bar = "#" * max(1, round(40 * c / total))
+                print(f"  {bucket_label(k, len(s['hist']) - 1):>12} µs {c:>7} {bar}")
+
+def main():
+    ap = argparse.ArgumentParser(description="Perfilador de hot paths por Raw HID")
+    ap.add_argument("--vid", type=parse_int, default=LILY58_VID)
+    ap.add_argument("--pid", type=parse_int, default=LILY58_PID)
+    ap.add_argument("--hist", action="store_true", help="muestra el histograma de cada sonda")
+    ap.add_argument("--reset", action="store_true", help="pone los contadores en cero")
+    ap.add_argument("--json", action="store_true")
+    args = ap.parse_args()
+
+    try:
+        with RawHid(args.vid, args.pid) as kb:
+            if args.reset:
+                kb.call(CMD_PROF_RESET)
+                print("✅ contadores en cero.")
+                return
+            stats = read_all(kb)
+    except RawHidError as e:
+        sys.exit(f"❌ {e}")
+
+    if args.json:
+        print(json.dumps(stats, sort_keys=True))
+    else:
+        print_table(stats, args.hist)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+key_emulator.py
+Compila keymap.c para el host (host/key_frames.c) y corre los casos de
+host/key_cases.txt: secuencias de teclas de la capa BASE con tiempos, y las teclas
+(con sus mods) que tienen que llegarle al host. Sirve para lo que depende del orden
+de los eventos (combos que retienen una tecla, mods soltados antes de tiempo) o del
+perfil de símbolos (snippets y SEND_LATAM() en cada layout del host).
+
+Requisitos: cc (gcc o clang). Sin QMK: los headers mínimos están en host/qmk/.
+Uso:
+  python3 key_emulator.py               # todos los casos (para CI)
+  python3 key_emulator.py shift_d       # solo los casos cuyo nombre contiene 'shift_d'
+  python3 key_emulator.py -v            # además la secuencia de cada caso
+"""
+
+import sys, argparse, subprocess
+
+from keymap_sparse_gen import parse_layers, LILY58_LAYOUT_MATRIX, DEFAULT_KEYMAP
+from oled_emulator import HOST_DIR, build
+from qmk_keycodes import parse, name
+from symbol_table import profile_names
+
+KEY_BIN = HOST_DIR / "key_frames"
+HOST_SRCS = ["key_frames.c", "rgblight_mock.c", "oled_mock.c", "qmk_host.c"]
+CASES = HOST_DIR / "key_cases.txt"
+
+def base_keys():
+    """{keycode de BASE: (fila, columna)}"""
+    _name, keys = parse_layers(DEFAULT_KEYMAP.read_text(encoding="utf-8"))[0]
+    out = {}
+    for kc, pos in zip(keys, LILY58_LAYOUT_MATRIX):
+        out.setdefault(kc, pos)
+    return out
+
+def load_cases(path, keys):
+    """[(nombre, órdenes para key_frames, [keycodes esperados], línea)]"""
+    profiles = profile_names()
+    cases = []
+    for n, line in enumerate(path.read_text(encoding="utf-8").splitlines(), 1):
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        word, _, rest = line.partition(" ")
+        if word == "==":
+            cases.append([rest.strip(), [], None, n])
+            continue
+        if not cases:
+            sys.exit(f"❌ {path.name}:{n}: orden antes del primer '== nombre'")
+        case = cases[-1]
+        if word in ("d", "u"):
+            if rest not in keys:
+                sys.exit(f"❌ {path.name}:{n}: {rest} no está en la capa BASE")
+            row, col = keys[rest]
+            case[1].append(f"key {row} {col} {word}")
+        elif word == "ms":
+            case[1].append(f"ms {int(rest)}")
+        elif word == "profile":
+            if rest not in profiles:
+                sys.exit(f"❌ {path.name}:{n}: perfiles: {', '.join(profiles)}")
+            case[1].append(f"profile {profiles.index(rest)}")
+        elif word == "expect":
+            try:
+                case[2] = [parse(k) for k in rest.split()]
+            except ValueError as e:
+                sys.exit(f"❌ {path.name}:{n}: {e}")
+        else:
+            sys.exit(f"❌ {path.name}:{n}: orden desconocida '{word}'")
+    for name_, _cmds, expect, n in cases:
+        if expect is None:
+            sys.exit(f"❌ {path.name}:{n}: el caso '{name_}' no tiene 'expect'")
+    return cases
+
+def run_case(cmds):
+    out = subprocess.run([str(KEY_BIN)], input="\n".join(cmds) + "\n", capture_output=True,
+                         text=True, check=True).stdout
+    return [int(rest, 16) for kind, _, rest in (l.partition(" ") for l in out.splitlines()) if kind == "sent"]
+
+def main():
+    ap = argparse.ArgumentParser(description="Pruebas de teclas del keymap en el host")
+    ap.add_argument("filter", nargs="?", default="", help="solo casos cuyo nombre contiene esto")
+    ap.add_argument("-v", "--verbose", action="store_true")
+    args = ap.parse_args()
+
+    cases = [c for c in load_cases(CASES, base_keys()) if args.filter in c[0]]
+    if not cases:
+        sys.exit(f"❌ ningún caso coincide con '{args.filter}'")
+    build(KEY_BIN, HOST_SRCS, ["OLED_ENABLE", "RGBLIGHT_ENABLE"], ["-lm"])
+
+    failed = []
+    for case_name, cmds, expect, _n in cases:
+        got = run_case(cmds)
+        ok = got == expect
+        print(f"{'✅' if ok else '❌'} {case_name}: {' '.join(name(k) for k in got) or '(nada)'}")
+        if not ok:
+            print(f"     se esperaba: {' '.join(name(k) for k in expect) or '(nada)'}")
+            failed.append(case_name)
+        if args.verbose:
+            for c in cmds:
+                print(f"     {c}")
+    if failed:
+        sys.exit(f"❌ {len(failed)} de {len(cases)} casos fallaron.")
+    print(f"✅ {len(cases)} casos.")
+
+if __name__ == "__main__":
+    main()
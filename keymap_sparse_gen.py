@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+keymap_sparse_gen.py
+Genera keymaps/keymap_sparse.h a partir del arreglo keymaps[] de keymap.c:
+solo guarda las teclas NO transparentes de cada capa, más un bitmap por fila
+(6 columnas -> 1 byte) y el offset de cada fila dentro del arreglo compacto.
+
+keymap_sparse.c usa esa tabla en keycode_at_keymap_location(): una tecla transparente
+se resuelve mirando un solo byte, y una no transparente con un popcount del byte.
+El mismo índice numera los contadores de press_count.c; KEYMAP_SPARSE_HASH (CRC de los
+bitmaps) cambia si se mueve alguna tecla no transparente, y con él se descartan los
+contadores guardados para otro keymap.
+
+Uso:
+  python3 keymap_sparse_gen.py                      # keymaps/keymap.c -> keymaps/keymap_sparse.h
+  python3 keymap_sparse_gen.py --keymap ruta/keymap.c
+  python3 keymap_sparse_gen.py --info keyboards/lily58/keyboard.json   # matriz desde QMK
+  python3 keymap_sparse_gen.py --check              # falla si el .h está desactualizado
+"""
+
+import re, sys, json, binascii, argparse
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+DEFAULT_KEYMAP = HERE / "keymaps" / "keymap.c"
+
+MATRIX_ROWS, MATRIX_COLS = 10, 6
+TRANSPARENT = {"_______", "KC_TRNS", "KC_TRANSPARENT"}
+
+# Orden de LAYOUT() del Lily58 -> (fila, columna) de la matriz.
+# La mitad derecha está espejada (R00 queda en la columna 5 de la fila 5).
+LILY58_LAYOUT_MATRIX = (
+    [(0, c) for c in range(6)] + [(5, c) for c in range(5, -1, -1)] +
+    [(1, c) for c in range(6)] + [(6, c) for c in range(5, -1, -1)] +
+    [(2, c) for c in range(6)] + [(7, c) for c in range(5, -1, -1)] +
+    [(3, c) for c in range(6)] + [(4, 5), (9, 5)] + [(8, c) for c in range(5, -1, -1)] +
+    [(4, 1), (4, 2), (4, 3), (4, 4), (9, 4), (9, 3), (9, 2), (9, 1)]
+)
+
+# ---------- Parser ----------
+def strip_comments(src):
+    src = re.sub(r"/\*.*?\*/", " ", src, flags=re.S)
+    return re.sub(r"//[^\n]*", " ", src)
+
+def split_args(body):
+    """Separa por comas de nivel 0 (respeta LSFT(LGUI(KC_S)))."""
+    out, depth, cur = [], 0, []
+    for ch in body:
+        if ch == "(":
+            depth += 1
+        elif ch == ")":
+            depth -= 1
+        if ch == "," and depth == 0:
+            out.append("".join(cur).strip()); cur = []
+        else:
+            cur.append(ch)
+    tail = "".join(cur).strip()
+    if tail:
+        out.append(tail)
+    return out
+
+def parse_layers(src):
+    """Devuelve [(nombre_capa, [keycodes en orden LAYOUT])]."""
+    src = strip_comments(src)
+    start = src.find("keymaps[]")
+    if start < 0:
+        sys.exit("⚠️  No encontré 'keymaps[]' en keymap.c")
+    layers = []
+    for m in re.finditer(r"\[\s*(\w+)\s*\]\s*=\s*LAYOUT\s*\(", src[start:]):
+        i = start + m.end()
+        depth, j = 1, i
+        while depth:
+            depth += {"(": 1, ")": -1}.get(src[j], 0); j += 1
+        layers.append((m.group(1), split_args(src[i:j - 1])))
+    if not layers:
+        sys.exit("⚠️  keymaps[] no contiene capas LAYOUT(...)")
+    return layers
+
+def load_matrix(info_path):
+    if not info_path:
+        return LILY58_LAYOUT_MATRIX
+    info = json.loads(Path(info_path).read_text(encoding="utf-8"))
+    layouts = info["layouts"]
+    layout = layouts.get("LAYOUT") or next(iter(layouts.values()))
+    return [tuple(k["matrix"]) for k in layout["layout"]]
+
+# ---------- Generador ----------
+def build(layers, matrix):
+    codes, rows_bits, rows_base = [], [], []
+    for name, keys in layers:
+        if len(keys) != len(matrix):
+            sys.exit(f"⚠️  Capa {name}: {len(keys)} teclas, LAYOUT espera {len(matrix)}")
+        grid = [[None] * MATRIX_COLS for _ in range(MATRIX_ROWS)]
+        for kc, (r, c) in zip(keys, matrix):
+            grid[r][c] = kc
+        bits, base = [], []
+        for r in range(MATRIX_ROWS):
+            base.append(len(codes))
+            b = 0
+            for c in range(MATRIX_COLS):
+                kc = grid[r][c]
+                # None = hueco de la matriz sin tecla física (KC_NO en LAYOUT); nunca se
+                # consulta, así que se guarda como transparente para no gastar bytes.
+                if kc is None or kc in TRANSPARENT:
+                    continue
+                b |= 1 << c
+                codes.append((name, r, c, kc))
+            bits.append(b)
+        rows_bits.append((name, bits)); rows_base.append((name, base))
+    return codes, rows_bits, rows_base
+
+def layout_hash(rows_bits):
+    """CRC-16/CCITT de la cantidad de capas y los bitmaps; nunca 0xFFFF (EEPROM borrada)."""
+    data = bytes([len(rows_bits)] + [b for _name, bits in rows_bits for b in bits])
+    crc = binascii.crc_hqx(data, 0xFFFF)
+    return crc ^ 1 if crc == 0xFFFF else crc
+
+def render(layers, codes, rows_bits, rows_base, src_name):
+    idx_t = "uint8_t" if len(codes) <= 0xFF else "uint16_t"
+    full = len(layers) * MATRIX_ROWS * MATRIX_COLS * 2
+    sparse = len(codes) * 2 + len(layers) * MATRIX_ROWS * (1 + (1 if idx_t == "uint8_t" else 2))
+    o = []
+    o.append("/* Generado por keymap_sparse_gen.py desde %s. NO editar a mano. */" % src_name)
+    o.append("#pragma once")
+    o.append("")
+    o.append("/* %d capas, %d teclas no transparentes: %d bytes (vs %d del arreglo completo) */"
+             % (len(layers), len(codes), sparse, full))
+    o.append("#define KEYMAP_SPARSE_LAYERS %d" % len(layers))
+    o.append("#define KEYMAP_SPARSE_CODES  %d" % len(codes))
+    o.append("#define KEYMAP_SPARSE_HASH   0x%04X   // posiciones no transparentes (press_count.c)"
+             % layout_hash(rows_bits))
+    o.append("#define keymap_sparse_read_base(p) %s(p)"
+             % ("pgm_read_byte" if idx_t == "uint8_t" else "pgm_read_word"))
+    o.append("")
+    o.append("/* keymap_sparse.c: índice en keymap_sparse_codes[]; KEYMAP_SPARSE_CODES = transparente */")
+    o.append("uint16_t keymap_sparse_index(uint8_t layer, uint8_t row, uint8_t col);")
+    o.append("")
+    o.append("/* bit c = columna c no transparente en esa fila */")
+    o.append("static const uint8_t PROGMEM keymap_sparse_bits[][MATRIX_ROWS] = {")
+    for name, bits in rows_bits:
+        o.append("  [%s] = { %s }," % (name, ", ".join("0x%02X" % b for b in bits)))
+    o.append("};")
+    o.append("")
+    o.append("/* índice en keymap_sparse_codes[] de la primera tecla de cada fila */")
+    o.append("static const %s PROGMEM keymap_sparse_base[][MATRIX_ROWS] = {" % idx_t)
+    for name, base in rows_base:
+        o.append("  [%s] = { %s }," % (name, ", ".join(str(b) for b in base)))
+    o.append("};")
+    o.append("")
+    o.append("static const uint16_t PROGMEM keymap_sparse_codes[KEYMAP_SPARSE_CODES] = {")
+    last = None
+    for name, r, c, kc in codes:
+        if name != last:
+            o.append("  /* %s */" % name); last = name
+        o.append("  %s, /* r%d c%d */" % (kc, r, c))
+    o.append("};")
+    return "\n".join(o) + "\n"
+
+def main():
+    ap = argparse.ArgumentParser(description="Keymap compacto (solo teclas no transparentes)")
+    ap.add_argument("--keymap", default=str(DEFAULT_KEYMAP))
+    ap.add_argument("--out", help="por defecto keymap_sparse.h junto a keymap.c")
+    ap.add_argument("--info", help="keyboard.json/info.json de QMK para leer la matriz de LAYOUT")
+    ap.add_argument("--check", action="store_true", help="solo verifica que el .h esté al día")
+    args = ap.parse_args()
+
+    keymap = Path(args.keymap)
+    out = Path(args.out) if args.out else keymap.with_name("keymap_sparse.h")
+    layers = parse_layers(keymap.read_text(encoding="utf-8"))
+    codes, rows_bits, rows_base = build(layers, load_matrix(args.info))
+    text = render(layers, codes, rows_bits, rows_base, keymap.name)
+
+    if args.check:
+        if not out.exists() or out.read_text(encoding="utf-8") != text:
+            print(f"⚠️  {out.name} desactualizado: ejecuta python3 keymap_sparse_gen.py"); sys.exit(1)
+        print(f"{out.name} al día."); return
+    out.write_text(text, encoding="utf-8")
+    print(f"{out.name}: {len(layers)} capas, {len(codes)} teclas no transparentes.")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,43 @@
+#include QMK_KEYBOARD_H
+#include "accent.h"
+#include "symbol_table.h"
+#include "symbol_hold.h"
+#include "macro_delay.h"
+
+/* vocal de cada ES_*ACU / ES_UDIA */
+static const uint8_t PROGMEM accent_vowel[ACCENT_LAST - ACCENT_FIRST + 1] = {
+  KC_A, KC_E, KC_I, KC_O, KC_U, KC_U,
+};
+
+static uint16_t pending;   // completa de la última muerta; KC_NO = nada pendiente
+static uint16_t pending_time;
+
+void accent_flush(void) {
+  if (pending == KC_NO) return;
+  uint16_t kc = pending;
+  pending = KC_NO;
+  symbol_send(kc);
+}
+
+void accent_dead(uint16_t dead, uint16_t done) {
+  accent_flush();
+  symbol_send(dead);
+  if (done == dead) return;
+  pending = done;
+  pending_time = timer_read();
+}
+
+/* muerta + vocal: 4 reportes seguidos, la vocal compone con la muerta en el host.
+   La muerta sale de la tabla de símbolos del perfil activo, como SYM_CARET */
+void accent_send(uint16_t keycode, bool shifted) {
+  uint8_t i = keycode - ACCENT_FIRST;
+  uint16_t vowel = pgm_read_byte(&accent_vowel[i]);
+  accent_flush();
+  symbol_send(symbol_tap(keycode == ES_UDIA ? SYM_DIAER : SYM_ACUTE, false));
+  symbol_send(shifted ? S(vowel) : vowel);
+}
+
+/* el host necesita la muerta suelta un rato antes de la completa (macro_delay.py) */
+void accent_task(void) {
+  if (pending != KC_NO && timer_elapsed(pending_time) >= macro_delay()) accent_flush();
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include QMK_KEYBOARD_H
+
+/* ──────────────────────────────────────────────────────────────
+ *  Acentos con teclas muertas (accent.c)
+ *  - Capa _ACC (SYM + NAV sostenidas): á é í ó ú ü en un toque.
+ *    Cada una manda la muerta del perfil (´ o ¨) y la vocal, con
+ *    Shift si está apretado, sin esperas ni espacio: la muerta
+ *    se completa con la vocal misma.
+ *  - accent_dead(): muerta que el host completa con otra tecla
+ *    (^ + espacio). La completa queda pendiente y sale desde
+ *    housekeeping pasados macro_delay() ms, o antes de la próxima
+ *    tecla: sin wait_ms() y sin que la siguiente se componga.
+ *  - Las muertas son SYM_ACUTE / SYM_DIAER de la tabla de símbolos
+ *    (por perfil, editables con symbol_table.py); KC_NO en un
+ *    perfil sin muertas (US): sale la vocal sola.
+ * ────────────────────────────────────────────────────────────*/
+#define ACCENT_FIRST ES_AACU
+#define ACCENT_LAST  ES_UDIA
+
+void accent_send(uint16_t keycode, bool shifted);   // ES_AACU ... ES_UDIA
+void accent_dead(uint16_t dead, uint16_t done);     // done: completa pendiente (o KC_NO)
+void accent_flush(void);                            // manda la completa pendiente, si hay
+void accent_task(void);                             // housekeeping_task_user
@@ -0,0 +1,40 @@
+#pragma once
+#include "quantum.h"
+
+/* Capas y keycodes compartidos por keymap.c y los módulos del keymap */
+enum layer_number { _BASE=0, _SYM, _NUM, _SYS, _NAV, _ACC };   // _ACC = _SYM + _NAV
+
+/* Keycodes personalizados */
+enum custom_keycodes {
+  /* letras/signos ES */
+  ES_NTIL = SAFE_RANGE, ES_NTIL_CAP, ES_IQUES, ES_IEXCL, ES_QUES,
+
+  /* símbolos de la fila SYM */
+  SYM_BACKTICK, SYM_TILDE, SYM_LT, SYM_GT,
+  SYM_LBRC, SYM_RBRC, SYM_LCBR, SYM_RCBR,
+  SYM_PIPE, SYM_BSLS, SYM_AT, SYM_SLASH,
+  SYM_INIT_A,SYM_INIT_G, SYM_KC_COLN, SYM_CARET,
+
+  /* teclas muertas ´ ¨ de la capa ACC (accent.c): solo en la tabla de símbolos */
+  SYM_ACUTE, SYM_DIAER,
+
+  /* operadores “normales” */
+  EQL_SYM, MINUS_SYM, SLASH_SYM, ASTER_SYM, PLUS_SYM, MINUS_UNDER,
+
+  /* utilitarios */
+  DQUO_SYM, SQUO_SYM, BKTICK3_SYM,
+
+  MACRO_YAKU,
+
+  /* snippets (snippets.c): mismo orden que assets/snippets.txt */
+  SNIP_ARROW, SNIP_ARROW_ASYNC, SNIP_CONSOLE, SNIP_INCLUDE, SNIP_INCLUDE_STD, SNIP_PRAGMA,
+  SNIP_C_MAIN, SNIP_SHEBANG_SH, SNIP_SHEBANG_PY, SNIP_PY_MAIN, SNIP_PY_ARGPARSE, SNIP_FENCE_BASH,
+  /* solo por leader (assets/leader.txt) */
+  SNIP_GIT_STATUS, SNIP_GIT_DIFF, SNIP_GIT_LOG, SNIP_GIT_COMMIT, SNIP_GIT_PUSH,
+
+  /* leader: secuencias de assets/leader.txt (leader_trie.c) */
+  LEADER_KEY,
+
+  /* vocales acentuadas (accent.c): tecla muerta + vocal en un solo toque */
+  ES_AACU, ES_EACU, ES_IACU, ES_OACU, ES_UACU, ES_UDIA,
+};
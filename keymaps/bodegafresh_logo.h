@@ -1,9 +1,19 @@
+/* Generado por oled_logo_rle.py desde bodegafresh_logo.h. NO editar a mano. */
 #pragma once
 #include <avr/pgmspace.h>
-#define BODEGAFRESH_W 112
-#define BODEGAFRESH_H 16
-static const char PROGMEM bodegafresh_logo_112x16[] = {
- 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x3F, 0xE0, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x3F, 0xCF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x3F, 0xCF, 0xC3, 0x8F, 0x3C, 0xFC, 0xC8, 0xC3, 0x41, 0xE2, 0xF0, 0xC1, 0x09, 0xFF, 0x3F, 0xCF, 0x99, 0x67, 0x9C, 0x79, 0xC6, 0x9D, 0x73, 0x7C, 0xE6, 0xBC, 0x71, 0xFE, 0x3F, 0xE0, 0x3C, 0xF3, 0xCC, 0x33, 0xCF, 0x9F, 0x73, 0x3E, 0xCF, 0xFC, 0x79, 0xFE, 0x3F, 0xCF, 0x3C, 0xF3, 0x0C, 0x30, 0xCF, 0x81, 0x73, 0x3E, 0xC0, 0xC0, 0x79, 0xFE, 0x3F, 0xCF, 0x3C, 0xF3, 0xCC, 0x3F, 0xCF, 0x9C, 0x73, 0x3E, 0xFF, 0x81, 0x79, 0xFE, 0x3F, 0xCF, 0x3C, 0xF3, 0xCC, 0x3F, 0xCF, 0x9C, 0x73, 0x3E, 0xFF, 0x9F, 0x79, 0xFE, 0x3F, 0xCF, 0x99, 0x67, 0x9C, 0x77, 0xC6, 0x8C, 0x73, 0x7E, 0xDE, 0x9E, 0x79, 0xFE, 0x3F, 0xE0, 0xC3, 0x8F, 0x3C, 0xF8, 0xC8, 0x91, 0x73, 0xFE, 0xE0, 0xC1, 0x79, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+#define BODEGAFRESH_LOGO_W 112
+#define BODEGAFRESH_LOGO_H 16
+/* RLE: 175 bytes -> 256 bytes descomprimidos (ver oled_rle.c) */
+static const uint8_t PROGMEM bodegafresh_logo_rle[] = {
+ 0x00, 0x01, 0x9E, 0xFF, 0x00, 0xFC, 0x81, 0xFF, 0x00, 0xC7, 0x81, 0xFF, 0x03, 0xF9, 0xFF, 0x3F,
+ 0xE0, 0x80, 0xFF, 0x00, 0xFC, 0x81, 0xFF, 0x00, 0xF3, 0x81, 0xFF, 0x03, 0xF9, 0xFF, 0x3F, 0xCF,
+ 0x80, 0xFF, 0x00, 0xFC, 0x81, 0xFF, 0x00, 0xF3, 0x81, 0xFF, 0x35, 0xF9, 0xFF, 0x3F, 0xCF, 0xC3,
+ 0x8F, 0x3C, 0xFC, 0xC8, 0xC3, 0x41, 0xE2, 0xF0, 0xC1, 0x09, 0xFF, 0x3F, 0xCF, 0x99, 0x67, 0x9C,
+ 0x79, 0xC6, 0x9D, 0x73, 0x7C, 0xE6, 0xBC, 0x71, 0xFE, 0x3F, 0xE0, 0x3C, 0xF3, 0xCC, 0x33, 0xCF,
+ 0x9F, 0x73, 0x3E, 0xCF, 0xFC, 0x79, 0xFE, 0x3F, 0xCF, 0x3C, 0xF3, 0x0C, 0x30, 0xCF, 0x81, 0x73,
+ 0x3E, 0x80, 0xC0, 0x39, 0x79, 0xFE, 0x3F, 0xCF, 0x3C, 0xF3, 0xCC, 0x3F, 0xCF, 0x9C, 0x73, 0x3E,
+ 0xFF, 0x81, 0x79, 0xFE, 0x3F, 0xCF, 0x3C, 0xF3, 0xCC, 0x3F, 0xCF, 0x9C, 0x73, 0x3E, 0xFF, 0x9F,
+ 0x79, 0xFE, 0x3F, 0xCF, 0x99, 0x67, 0x9C, 0x77, 0xC6, 0x8C, 0x73, 0x7E, 0xDE, 0x9E, 0x79, 0xFE,
+ 0x3F, 0xE0, 0xC3, 0x8F, 0x3C, 0xF8, 0xC8, 0x91, 0x73, 0xFE, 0xE0, 0xC1, 0x79, 0xFE, 0x84, 0xFF,
+ 0x00, 0xCF, 0x8A, 0xFF, 0x01, 0x7F, 0xE7, 0x8B, 0xFF, 0x00, 0xF0, 0x85, 0xFF, 0x9E, 0x00,
 };
-
-
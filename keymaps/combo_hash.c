@@ -0,0 +1,78 @@
+#include QMK_KEYBOARD_H
+#include "combo_hash.h"
+#include "bodegafresh_keycodes.h"
+#include "combo_hash_data.h"
+
+#define NO_POS 0xFF
+
+/* tecla retenida a la espera de su pareja */
+static bool waiting = false;
+static uint8_t held_pos;
+static uint16_t held_keycode, held_time;
+static keyrecord_t held_record;
+
+/* las dos teclas del último combo: sus sueltas se descartan */
+static uint8_t combo_pos[2] = { NO_POS, NO_POS };
+
+static uint8_t key_pos(keyrecord_t *record) {
+  return record->event.key.row * MATRIX_COLS + record->event.key.col;
+}
+
+static bool combo_member(uint8_t pos) {
+  return (pgm_read_byte(&combo_members[pos / 8]) >> (pos % 8)) & 1;
+}
+
+static uint16_t combo_lookup(uint8_t a, uint8_t b) {
+  uint16_t key = a < b ? (a << 6 | b) : (b << 6 | a);
+  uint8_t slot = (uint16_t)(key * (uint16_t)COMBO_HASH_MULT) >> COMBO_HASH_SHIFT;
+  if (pgm_read_word(&combo_keys[slot]) != key) return KC_NO;
+  return pgm_read_word(&combo_actions[slot]);
+}
+
+static void combo_flush(void) {
+  if (!waiting) return;
+  waiting = false;
+  combo_hash_replay_user(held_keycode, &held_record);
+}
+
+bool combo_hash_process(uint16_t keycode, keyrecord_t *record) {
+  uint8_t pos = key_pos(record);
+  if (!record->event.pressed) {
+    for (uint8_t i = 0; i < 2; i++) {
+      if (combo_pos[i] == pos) {
+        combo_pos[i] = NO_POS;
+        return false;
+      }
+    }
+    /* cualquier suelta va después de la tecla retenida: si Shift se suelta antes de que
+       venza el plazo, la tecla sale con Shift como se apretó (Shift+D no da d) */
+    combo_flush();
+    return true;
+  }
+
+  if (waiting) {
+    uint16_t action = combo_member(pos) ? combo_lookup(held_pos, pos) : KC_NO;
+    if (action != KC_NO && timer_elapsed(held_time) <= COMBO_HASH_TERM) {
+      waiting = false;
+      combo_pos[0] = held_pos;
+      combo_pos[1] = pos;
+      combo_hash_matched_user(action);
+      return false;
+    }
+    combo_flush();
+  }
+
+  if (combo_member(pos) && keycode <= QK_BASIC_MAX && get_highest_layer(layer_state) == _BASE) {
+    waiting = true;
+    held_pos = pos;
+    held_keycode = keycode;
+    held_record = *record;
+    held_time = timer_read();
+    return false;
+  }
+  return true;
+}
+
+void combo_hash_task(void) {
+  if (waiting && timer_elapsed(held_time) > COMBO_HASH_TERM) combo_flush();
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include QMK_KEYBOARD_H
+
+/* ──────────────────────────────────────────────────────────────
+ *  Combos de dos teclas (combo_hash.c, tabla de combo_gen.py)
+ *  J+K -> { sin pasar por MO(_SYM). La tabla es un hash perfecto
+ *  sobre las posiciones ordenadas: cada tecla mira un bit de
+ *  combo_members[] y, si hace falta, un solo slot.
+ *  - La primera tecla de un posible combo se retiene hasta
+ *    COMBO_HASH_TERM ms; si no llega su pareja, se manda tal cual.
+ *    Cualquier otro evento (también una suelta) la manda antes,
+ *    así el orden y los mods son los de la matriz.
+ *  - Solo en BASE; las sueltas de un combo no llegan al keymap.
+ * ────────────────────────────────────────────────────────────*/
+#ifndef COMBO_HASH_TERM
+#  define COMBO_HASH_TERM 40
+#endif
+
+bool combo_hash_process(uint16_t keycode, keyrecord_t *record);   // false: tecla consumida
+void combo_hash_task(void);                                        // housekeeping_task_user
+
+/* El keymap ejecuta la acción de un combo, y manda la tecla retenida si no hubo combo */
+void combo_hash_matched_user(uint16_t keycode);
+void combo_hash_replay_user(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,34 @@
+/* Generado por combo_gen.py desde assets/combos.txt. NO editar a mano. */
+#pragma once
+#include <avr/pgmspace.h>
+
+#define COMBO_HASH_MULT  77
+#define COMBO_HASH_SHIFT 13
+#define COMBO_HASH_SIZE  8
+#define COMBO_HASH_EMPTY 0xFFFF
+
+/* bit p = la posición p (fila * MATRIX_COLS + columna) está en algún combo */
+static const uint8_t PROGMEM combo_members[8] = { 0x00, 0x80, 0xC1, 0x00, 0x00, 0x70, 0x1C, 0x00 };
+
+/* slot -> clave (posiciones a << 6 | b) y acción */
+static const uint16_t PROGMEM combo_keys[COMBO_HASH_SIZE] = {
+  COMBO_HASH_EMPTY,
+  0x03D0,  // D F
+  0x0B2D,  // K L
+  0x0B6E,  // J K
+  COMBO_HASH_EMPTY,
+  0x0597,  // V B
+  0x0CB3,  // KC_COMM KC_DOT
+  0x0CF4,  // M KC_COMM
+};
+
+static const uint16_t PROGMEM combo_actions[COMBO_HASH_SIZE] = {
+  KC_NO,
+  SYM_PIPE,
+  SYM_RCBR,
+  SYM_LCBR,
+  KC_NO,
+  SYM_BACKTICK,
+  SYM_RBRC,
+  SYM_LBRC,
+};
@@ -7,6 +7,10 @@
 #define SPLIT_LAYER_STATE_ENABLE
 #define SPLIT_MODS_ENABLE
 #define SPLIT_LED_STATE_ENABLE
+#define SPLIT_ACTIVITY_ENABLE   // rgb_breathe.c: la esclava también ve la inactividad
+#define SPLIT_TRANSACTION_IDS_USER USER_IDLE_SYNC
+#define EECONFIG_USER_DATA_SIZE 128   // symbol_table.c: 2 + 4 bytes por símbolo; macro_delay.c: los 2 últimos
+#define OLED_TIMEOUT 0          // el apagado lo maneja idle_manager.c (IDLE_DIM_MS / IDLE_BLANK_MS)
 #define RGBLIGHT_SPLIT
 #define RGBLED_NUM 27
 #define RGBLED_SPLIT {14, 13}
@@ -20,3 +24,10 @@
 #define RGBLIGHT_SAT_STEP 8
 #define RGBLIGHT_VAL_STEP 8
 #define RGBLIGHT_SLEEP
+
+/* build de benchmark (simavr_bench.py): funciones medidas sin inline */
+#ifdef SIMAVR_BENCH
+#  define BENCH_NOINLINE __attribute__((noinline))
+#else
+#  define BENCH_NOINLINE
+#endif
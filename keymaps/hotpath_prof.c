@@ -0,0 +1,76 @@
+#include <stddef.h>
+#include <string.h>
+#include QMK_KEYBOARD_H
+#include "hotpath_prof.h"
+#include "raw_hid_cmd.h"
+
+#ifdef HOTPATH_PROF
+#ifdef __AVR__
+#  include <avr/io.h>
+#  include <avr/interrupt.h>
+#  define PROF_TICK_US (64000000UL / F_CPU)   // Timer0 de QMK: prescaler 64, CTC cada 1 ms
+#else
+#  define PROF_TICK_US 1000
+#endif
+
+/* 36 bytes por sonda; el orden de los campos es el que lee hotpath_prof.py */
+typedef struct {
+  uint32_t n, total;
+  uint16_t min, max;
+  uint16_t hist[PROF_BUCKETS];
+} prof_stat_t;
+
+static prof_stat_t stats[PROF_PROBES];
+
+/* µs módulo 2^16: sirve para medir tramos de hasta 65 ms */
+uint16_t prof_now_us(void) {
+#ifdef __AVR__
+  uint8_t sreg = SREG;
+  cli();
+  uint16_t ms = timer_read();
+  uint8_t tick = TCNT0;
+  if (TIFR0 & _BV(OCF0A)) { ms++; tick = TCNT0; }   // el ms cambió y la ISR aún no corrió
+  SREG = sreg;
+  return ms * 1000 + tick * PROF_TICK_US;
+#else
+  return timer_read() * 1000;
+#endif
+}
+
+void prof_record(uint8_t probe, uint16_t us) {
+  prof_stat_t *s = &stats[probe];
+  if (s->n == UINT32_MAX) return;
+  if (!s->n || us < s->min) s->min = us;
+  if (us > s->max) s->max = us;
+  s->n++;
+  s->total += us;
+  uint8_t b = 0;
+  for (uint16_t v = us >> 3; v && b < PROF_BUCKETS - 1; v >>= 1) b++;
+  if (s->hist[b] != UINT16_MAX) s->hist[b]++;
+}
+
+/* [cmd, sonda, parte] -> [cmd, estado, sonda, parte, datos] */
+uint8_t prof_raw_hid(uint8_t *data, uint8_t length) {
+  uint8_t probe = data[1], part = data[2];
+  uint8_t *out = data + 2;
+  switch (data[0]) {
+    case RAW_CMD_PROF_INFO:
+      out[0] = PROF_PROBES;
+      out[1] = PROF_BUCKETS;
+      out[2] = PROF_TICK_US & 0xFF;
+      out[3] = PROF_TICK_US >> 8;
+      return RAW_OK;
+    case RAW_CMD_PROF_RESET:
+      memset(stats, 0, sizeof stats);
+      return RAW_OK;
+    case RAW_CMD_PROF_READ:
+      if (probe >= PROF_PROBES || part > 1) return RAW_ERR_ARG;
+      out[0] = probe;
+      out[1] = part;
+      if (part == 0) memcpy(out + 2, &stats[probe], offsetof(prof_stat_t, hist));
+      else memcpy(out + 2, stats[probe].hist, sizeof stats[probe].hist);
+      return RAW_OK;
+  }
+  return RAW_ERR_UNKNOWN;
+}
+#endif
@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+
+/* ──────────────────────────────────────────────────────────────
+ *  Perfilador de hot paths (HOTPATH_PROF = yes en rules.mk)
+ *   PROF_START(PROF_X); ...; PROF_STOP(PROF_X);
+ *  Acumula en RAM n, total, min, max e histograma log2 en µs;
+ *  hotpath_prof.py los lee por Raw HID. Sin HOTPATH_PROF las
+ *  macros desaparecen.
+ * ────────────────────────────────────────────────────────────*/
+enum prof_probe {
+  PROF_LOOP = 0,        // vuelta completa del loop (scan + proceso + tareas)
+  PROF_PROCESS_RECORD,
+  PROF_OLED_TASK,
+  PROF_LIGHTING,        // apply_layer_lighting()
+  PROF_PROBES
+};
+
+/* bucket 0: < 8 µs; bucket k: [4·2^k, 4·2^(k+1)) µs; el último junta el resto */
+#define PROF_BUCKETS 12
+
+#ifdef HOTPATH_PROF
+uint16_t prof_now_us(void);
+void prof_record(uint8_t probe, uint16_t us);
+uint8_t prof_raw_hid(uint8_t *data, uint8_t length);
+
+#  define PROF_START(p) uint16_t prof_t0_##p = prof_now_us()
+#  define PROF_STOP(p)  prof_record(p, prof_now_us() - prof_t0_##p)
+#else
+#  define PROF_START(p)
+#  define PROF_STOP(p)
+#endif
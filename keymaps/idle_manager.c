@@ -0,0 +1,53 @@
+#include QMK_KEYBOARD_H
+#include "transactions.h"
+#include "idle_manager.h"
+#ifdef OLED_ENABLE
+#  include "oled_driver.h"
+#endif
+
+/* ──────────────────────────────────────────────────────────────
+ *  Inactividad (reemplaza OLED_TIMEOUT, ver config.h)
+ *  - La maestra mide last_input_activity_elapsed(): cualquier
+ *    tecla de cualquier mitad vuelve a IDLE_ACTIVE en el mismo loop.
+ *  - Cada cambio de estado es 1 RPC de 1 byte a la esclava; si el
+ *    split está ocupado se reintenta en el próximo loop.
+ *  - La esclava no mide nada: aplica lo que recibe.
+ * ────────────────────────────────────────────────────────────*/
+static uint8_t state = IDLE_ACTIVE;
+static bool pending_sync = false;
+
+__attribute__((weak)) void idle_changed_user(uint8_t new_state) {}
+
+static void apply(uint8_t new_state) {
+  if (new_state == state) return;
+  state = new_state;
+#ifdef OLED_ENABLE
+  switch (state) {
+    case IDLE_ACTIVE: oled_on(); oled_set_brightness(OLED_BRIGHTNESS);   break;
+    case IDLE_DIM:    oled_on(); oled_set_brightness(IDLE_OLED_DIM_LEVEL); break;
+    case IDLE_BLANK:  oled_off();                                        break;
+  }
+#endif
+  idle_changed_user(state);
+}
+
+static void idle_sync_slave(uint8_t in_len, const void *in_data, uint8_t out_len, void *out_data) {
+  if (in_len >= 1) apply(*(const uint8_t *)in_data);
+}
+
+void idle_init(void) {
+  transaction_register_rpc(USER_IDLE_SYNC, idle_sync_slave);
+}
+
+void idle_task(void) {
+  if (!is_keyboard_master()) return;
+  uint32_t idle = last_input_activity_elapsed();
+  uint8_t next = idle >= IDLE_BLANK_MS ? IDLE_BLANK : idle >= IDLE_DIM_MS ? IDLE_DIM : IDLE_ACTIVE;
+  if (next != state) {
+    apply(next);
+    pending_sync = true;
+  }
+  if (pending_sync && is_transport_connected() && transaction_rpc_send(USER_IDLE_SYNC, sizeof state, &state)) pending_sync = false;
+}
+
+uint8_t idle_state(void) { return state; }
@@ -0,0 +1,31 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Estados de inactividad; la maestra los decide y los manda a la esclava
+   en un solo mensaje del split (USER_IDLE_SYNC) por cada cambio. */
+enum idle_state {
+  IDLE_ACTIVE = 0,
+  IDLE_DIM,       // OLED atenuado, RGB congelado
+  IDLE_BLANK,     // OLED apagado, RGB congelado
+};
+
+#ifndef IDLE_DIM_MS
+#  define IDLE_DIM_MS 30000
+#endif
+#ifndef IDLE_BLANK_MS
+#  define IDLE_BLANK_MS 120000
+#endif
+#ifndef IDLE_OLED_DIM_LEVEL
+#  define IDLE_OLED_DIM_LEVEL 16
+#endif
+#ifndef OLED_BRIGHTNESS
+#  define OLED_BRIGHTNESS 255
+#endif
+
+void idle_init(void);           // keyboard_post_init_user
+void idle_task(void);           // housekeeping_task_user
+uint8_t idle_state(void);
+
+/* El keymap reacciona a cada cambio (en ambas mitades), p. ej. congelando el RGB */
+void idle_changed_user(uint8_t state);
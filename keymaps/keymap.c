@@ -9,64 +9,61 @@
  *  - @   = AltGr+Q
  *  - /   = Shift+7
  *  Sin Unicode. Usa tap_clean() para evitar mods “pegados”.
+ *  Los keycodes de cada símbolo están en symbol_table.c y se
+ *  cambian en caliente con symbol_table.py (Raw HID + EEPROM).
  * ────────────────────────────────────────────────────────────*/
 
-enum layer_number { _BASE=0, _SYM, _NUM, _SYS, _NAV };
-
-/* Keycodes personalizados */
-enum custom_keycodes {
-  /* letras/signos ES */
-  ES_NTIL = SAFE_RANGE, ES_NTIL_CAP, ES_IQUES, ES_IEXCL, ES_QUES,
-
-  /* símbolos de la fila SYM */
-  SYM_BACKTICK, SYM_TILDE, SYM_LT, SYM_GT,
-  SYM_LBRC, SYM_RBRC, SYM_LCBR, SYM_RCBR,
-  SYM_PIPE, SYM_BSLS, SYM_AT, SYM_SLASH,
-  SYM_INIT_A,SYM_INIT_G, SYM_KC_COLN, SYM_CARET,
-
-  /* operadores “normales” */
-  EQL_SYM, MINUS_SYM, SLASH_SYM, ASTER_SYM, PLUS_SYM, MINUS_UNDER,
-
-  /* utilitarios */
-  DQUO_SYM, SQUO_SYM, BKTICK3_SYM,
-
-  MACRO_YAKU,
-};
+#include "bodegafresh_keycodes.h"
+#include "symbol_table.h"
+#include "idle_manager.h"
+#include "hotpath_prof.h"
+#include "snippets.h"
+#include "leader_trie.h"
+#include "combo_hash.h"
+#include "symbol_hold.h"
+#include "accent.h"
+#include "macro_delay.h"
+#ifdef SCAN_METER
+#  include "scan_meter.h"
+#endif
+#ifdef PRESS_COUNT
+#  include "press_count.h"
+#endif
 
 /* Helpers */
 static inline bool shift_active(void){
   return (get_mods() | get_oneshot_mods()) & MOD_MASK_SHIFT;
 }
 
-/* limpia mods/oneshot, envía, y restaura (evita AltGr/Shift “pegados”) */
+/* toque con los mods justos de kc (evita AltGr/Shift “pegados”): los del usuario
+   se esconden y vuelven en el reporte de la suelta; ver symbol_hold.c */
 static inline void tap_clean(uint16_t kc){
-  uint8_t m = get_mods(), o = get_oneshot_mods();
-  clear_mods(); clear_oneshot_mods(); send_keyboard_report();
-  tap_code16(kc);
-  set_mods(m); set_oneshot_mods(o); send_keyboard_report();
+  symbol_send(kc);
 }
 
 static inline void send_yakuake(void){
     tap_code16(C(S(KC_F12)));   // Ctrl + Shift + F12
 }
 
+/* la espera la calibra macro_delay.py contra el host (EEPROM; 18 ms sin calibrar) */
 static inline void tap_once16(uint16_t kc) {
     register_code16(kc);
-    wait_ms(18);            // 15–25ms suele ser perfecto
+    macro_delay_wait();
     unregister_code16(kc);
-    wait_ms(18);
+    macro_delay_wait();
 }
 
 static inline void send_triple_backtick(void){
-    tap_once16(RALT(KC_NUHS));   // `
-    tap_once16(RALT(KC_NUHS));   // `
-    tap_once16(RALT(KC_NUHS));   // `
+    uint16_t kc = symbol_tap(SYM_BACKTICK, false);   // `
+    tap_once16(kc);
+    tap_once16(kc);
+    tap_once16(kc);
 }
 
+/* ^: en LATAM es tecla muerta y se completa con la tecla "shifted" de la tabla;
+   la completa sale después, sin bloquear (accent.c) */
 static inline void send_caret_from_dead(void){
-    tap_clean(RALT(KC_LBRC));  // dead_circumflex
-    wait_ms(18);
-    tap_clean(KC_SPC);
+    accent_dead(symbol_tap(SYM_CARET, false), symbol_tap(SYM_CARET, true));
 }
 /* ──────────────────────────────────────────────────────────────
  * Keymaps
@@ -81,12 +78,12 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
                  KC_LALT, KC_LGUI, MO(_SYM), KC_SPC, KC_ENT, MO(_NAV), TG(_NUM), TG(_SYS)
 ),
 
-/* SYM (fila 1: `~<>[]{}|\@/) */
+/* SYM (fila 1: `~<>[]{}|\@/; filas 3-4: snippets de snippets.c y LEADER_KEY) */
 [_SYM] = LAYOUT(
   SYM_BACKTICK, SYM_TILDE, SYM_LT,  SYM_GT,  SYM_LBRC, SYM_RBRC, SYM_LCBR, SYM_RCBR, SYM_PIPE, SYM_BSLS, SYM_AT,  SYM_SLASH,
   SYM_INIT_A, BKTICK3_SYM, SQUO_SYM , DQUO_SYM, ASTER_SYM, KC_CAPS, SYM_KC_COLN, ES_IQUES, ES_QUES, ES_IEXCL, KC_EXLM,  SYM_INIT_G,
-  SYM_CARET, _______,   _______, _______, _______, _______,   _______, _______, _______,  _______,   _______,  MACRO_YAKU,
-  _______,      _______,   _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______,
+  SYM_CARET, SNIP_SHEBANG_SH, SNIP_SHEBANG_PY, SNIP_PY_MAIN, SNIP_PY_ARGPARSE, SNIP_FENCE_BASH,   SNIP_ARROW, SNIP_ARROW_ASYNC, SNIP_CONSOLE, SNIP_INCLUDE, SNIP_PRAGMA, MACRO_YAKU,
+  _______,      SNIP_INCLUDE_STD, SNIP_C_MAIN, LEADER_KEY, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______,
                            _______, _______, _______, _______, _______, _______, _______, _______
 ),
 
@@ -116,58 +113,97 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
   KC_LCTL, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______,
                            _______, _______, _______, _______, _______, _______, _______, _______
 ),
+
+/* ACC (SYM + NAV): vocales acentuadas en su lugar de BASE, ü en la J */
+[_ACC] = LAYOUT(
+  _______, _______, _______, _______, _______, _______,                   _______, _______, _______, _______, _______, _______,
+  _______, _______, _______, ES_EACU, _______, _______,                   _______, ES_UACU, ES_IACU, ES_OACU, _______, _______,
+  _______, ES_AACU, _______, _______, _______, _______,                   _______, ES_UDIA, _______, _______, _______, _______,
+  _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______, _______,
+                           _______, _______, _______, _______, _______, _______, _______, _______
+),
 };
 
+/* keymap_sparse.c resuelve las teclas desde keymap_sparse.h; este arreglo es
+   solo la fuente del generador y el linker lo descarta. */
+#include "keymap_sparse.h"
+_Static_assert(sizeof(keymaps) / sizeof(keymaps[0]) == KEYMAP_SPARSE_LAYERS,
+               "keymap_sparse.h desactualizado: python3 keymap_sparse_gen.py");
+
 /* ──────────────────────────────────────────────────────────────
  * Lógica personalizada
  * ────────────────────────────────────────────────────────────*/
-bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+static inline bool process_record_keymap(uint16_t keycode, keyrecord_t *record) {
   if (!record->event.pressed) return true;
 
   switch (keycode) {
-    /* Ñ/¿/¡ */
-    case ES_NTIL:       tap_clean(shift_active() ? S(KC_SCLN) : KC_SCLN);  return false;
-    case ES_NTIL_CAP:   tap_clean(S(KC_SCLN));                             return false;
-    case ES_IQUES:      tap_clean(KC_EQL);                                 return false; // ¿
-    case ES_IEXCL:      tap_clean(S(RALT(KC_1)));                          return false; // ¡
-    case ES_QUES:       tap_clean(S(KC_MINS));                             return false; // ?
-
-    /* Fila SYM (según tu XKB) */
-    case SYM_BACKTICK:  tap_clean(RALT(KC_NUHS));          return false; // `  (si no cuadra, te ajusto esto)
-    case SYM_TILDE:     tap_clean(RALT(KC_4));             return false; // ~  (ídem)
-    case SYM_LT:        tap_clean(KC_NUBS);                return false; // <
-    case SYM_GT:        tap_clean(S(KC_NUBS));             return false; // >
-    case SYM_LBRC:      tap_clean(RALT(KC_8));             return false; // [
-    case SYM_RBRC:      tap_clean(RALT(KC_9));             return false; // ]  (o RALT(KC_0) según distro)
-    case SYM_LCBR:      tap_clean(RALT(KC_7));             return false; // {
-    case SYM_RCBR:      tap_clean(RALT(KC_0));             return false; // }  (o RALT(S(KC_0)))
-    case SYM_BSLS:      tap_clean(RALT(KC_MINS));          return false; // (\)
-    case SYM_PIPE:      tap_clean(RALT(KC_1));             return false; // |
-    case SYM_AT:        tap_clean(RALT(KC_Q));             return false; // @
-    case SYM_SLASH:     tap_clean(S(KC_7));                return false; // /
-    case SYM_INIT_A:    tap_clean(RALT(KC_GRV));           return false; // ¬
-    case SYM_INIT_G:    tap_clean(S(KC_GRV));              return false; // °
-    case SYM_KC_COLN:   tap_clean(S(KC_DOT));              return false; // :
-    case SYM_CARET:     send_caret_from_dead();            return false; // ^
-
-    /* Operadores */
-    case EQL_SYM:       tap_clean(S(KC_0));                return false; // =
-    case MINUS_SYM:     tap_clean(KC_SLSH);                return false; // -
-    case SLASH_SYM:     tap_clean(S(KC_7));                return false; // /
-    case ASTER_SYM:     tap_clean(KC_KP_ASTERISK);         return false; // *
-    case PLUS_SYM:      tap_clean(KC_KP_PLUS);             return false; // +
-    case MINUS_UNDER:   tap_clean(shift_active() ? S(KC_SLSH) : KC_SLSH); return false; // _ / -
+    /* Ñ/¿/¡, fila SYM, operadores y comillas: symbol_table.c. Las teclas reales
+       las sostiene symbol_hold.c; acá llegan ^ y las acciones de leader/combos */
+    case SYMBOL_FIRST ... SYMBOL_LAST:
+      if (keycode == SYM_CARET) send_caret_from_dead();   // ^ (tecla muerta + espacio)
+      else tap_clean(symbol_tap(keycode, shift_active()));
+      return false;
 
     /* utilitarios */
-    case DQUO_SYM:      tap_clean(RALT(KC_LBRC));          return false; // "
-    case SQUO_SYM:      tap_clean(KC_LBRC);                return false; // '
     case BKTICK3_SYM:   send_triple_backtick();            return false;
-
     case MACRO_YAKU:    send_yakuake();                    return false;
+
+    /* tecla muerta + vocal, sin espacio (accent.c) */
+    case ACCENT_FIRST ... ACCENT_LAST:
+      accent_send(keycode, shift_active());
+      return false;
+
+    /* texto comprimido en PROGMEM; sale de a poco desde housekeeping_task_user() */
+    case SNIPPET_FIRST ... SNIPPET_LAST:
+      snippet_queue(keycode);
+      return false;
   }
   return true;
 }
 
+/* leader y combos: la acción se procesa como si fuera una tecla del keymap
+   (SYM_* por tap_clean(symbol_tap()), SNIP_* a la cola, el resto tal cual) */
+static void run_action(uint16_t keycode){
+  keyrecord_t press = { .event = { .pressed = true } };
+  if (process_record_keymap(keycode, &press)) tap_clean(keycode);
+}
+
+void leader_trie_matched_user(uint16_t keycode){
+  run_action(keycode);
+}
+
+void combo_hash_matched_user(uint16_t keycode){
+  run_action(keycode);
+}
+
+/* macros de prueba de macro_delay.py */
+void macro_delay_run_user(uint16_t keycode){
+  run_action(keycode);
+}
+
+/* teclas reales: leader y símbolos sostenidos antes del keymap */
+static bool process_record_keys(uint16_t keycode, keyrecord_t *record){
+  return leader_trie_process(keycode, record) &&
+         symbol_hold_process(keycode, record) &&
+         process_record_keymap(keycode, record);
+}
+
+/* sin combo: la tecla retenida sigue como si acabara de apretarse */
+void combo_hash_replay_user(uint16_t keycode, keyrecord_t *record){
+  if (process_record_keys(keycode, record)) register_code16(keycode);
+}
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+  PROF_START(PROF_PROCESS_RECORD);
+#ifdef PRESS_COUNT
+  press_count_hit(record);
+#endif
+  if (record->event.pressed) accent_flush();   // la completa de ^ va antes que la tecla
+  bool ret = combo_hash_process(keycode, record) && process_record_keys(keycode, record);
+  PROF_STOP(PROF_PROCESS_RECORD);
+  return ret;
+}
+
 /* ──────────────────────────────────────────────────────────────
  * RGB “breathing”
  * ────────────────────────────────────────────────────────────*/
@@ -179,60 +215,142 @@ static bool uppercase_active(void) {
   return host_keyboard_led_state().caps_lock || shift_active_local();
 }
 
-static void apply_layer_lighting(layer_state_t st) {
+#ifdef RGB_BREATHE_LUT
+#include "rgb_breathe.h"
+#include "rgb_breathe_table.h"
+_Static_assert((int)RGB_BREATHE_ACC == (int)_ACC, "rgb_breathe_table.h: colores en el orden de enum layer_number");
+
+/* Mismas prioridades que el breathing de rgblight; la curva y el RGB salen de la tabla */
+BENCH_NOINLINE static void apply_layer_lighting(layer_state_t st) {
+  PROF_START(PROF_LIGHTING);
+  uint8_t color = RGB_BREATHE_BASE;
+  if (uppercase_active()) color = RGB_BREATHE_CAPS;
+  else if (layer_state_cmp(st, _ACC)) color = RGB_BREATHE_ACC;
+  else if (layer_state_cmp(st, _SYS)) color = RGB_BREATHE_SYS;
+  else if (layer_state_cmp(st, _NUM)) color = RGB_BREATHE_NUM;
+  else if (layer_state_cmp(st, _NAV)) color = RGB_BREATHE_NAV;
+  else if (layer_state_cmp(st, _SYM)) color = RGB_BREATHE_SYM;
+  rgb_breathe_task(color, idle_state() != IDLE_ACTIVE);
+  PROF_STOP(PROF_LIGHTING);
+}
+static void lighting_init(void){
+  rgblight_enable_noeeprom();
+  rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);
+}
+/* en cada vuelta, ambas mitades: sin paso nuevo ni cambio de capa o de Shift/Caps
+   (llegan por el split) el frame sería el mismo, así que ni se arma */
+static void lighting_task(void){
+  static layer_state_t last_layers;
+  static bool last_upper;
+  bool upper = uppercase_active();
+  if (layer_state == last_layers && upper == last_upper && !rgb_breathe_due()) return;
+  last_layers = layer_state;
+  last_upper = upper;
+  apply_layer_lighting(layer_state);
+}
+/* al congelar o despertar, y al volver de suspend, se reescribe el frame entero */
+void idle_changed_user(uint8_t state){
+  rgb_breathe_invalidate();
+}
+void suspend_wakeup_init_user(void){
+  rgb_breathe_invalidate();
+}
+#else
+BENCH_NOINLINE static void apply_layer_lighting(layer_state_t st) {
+  PROF_START(PROF_LIGHTING);
   rgblight_mode_noeeprom(RGBLIGHT_MODE_BREATHING);
   rgblight_set_speed(60);
-  if (uppercase_active()) { rgblight_sethsv_noeeprom(HSV_RED); return; }
-  if (layer_state_cmp(st, _SYS)) rgblight_sethsv_noeeprom(HSV_MAGENTA);
+  if (uppercase_active()) rgblight_sethsv_noeeprom(HSV_RED);
+  else if (layer_state_cmp(st, _ACC)) rgblight_sethsv_noeeprom(HSV_CYAN);
+  else if (layer_state_cmp(st, _SYS)) rgblight_sethsv_noeeprom(HSV_MAGENTA);
   else if (layer_state_cmp(st, _NUM)) rgblight_sethsv_noeeprom(HSV_GREEN);
   else if (layer_state_cmp(st, _NAV)) rgblight_sethsv_noeeprom(HSV_YELLOW);
   else if (layer_state_cmp(st, _SYM)) rgblight_sethsv_noeeprom(HSV_BLUE);
   else rgblight_sethsv_noeeprom(HSV_WHITE);
+  PROF_STOP(PROF_LIGHTING);
 }
-void keyboard_post_init_user(void){
+static void lighting_init(void){
   rgblight_enable_noeeprom();
   apply_layer_lighting(layer_state);
 }
-layer_state_t layer_state_set_user(layer_state_t s){ apply_layer_lighting(s); return s; }
 bool led_update_user(led_t led_state){ apply_layer_lighting(layer_state); return true; }
 void post_process_record_user(uint16_t keycode, keyrecord_t *record){
   if (keycode==KC_LSFT || keycode==KC_RSFT || keycode==KC_CAPS) apply_layer_lighting(layer_state);
 }
+/* congelado (idle_manager.c): luz estática en el color actual hasta la próxima tecla */
+void idle_changed_user(uint8_t state){
+  if (state == IDLE_ACTIVE) apply_layer_lighting(layer_state);
+  else rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);
+}
+#endif
+#endif
+
+/* SYM + NAV = ACC */
+layer_state_t layer_state_set_user(layer_state_t s){
+  s = update_tri_layer_state(s, _SYM, _NAV, _ACC);
+#if defined(RGBLIGHT_ENABLE) && !defined(RGB_BREATHE_LUT)
+  apply_layer_lighting(s);
 #endif
+  return s;
+}
 
 /* OLED */
 #ifdef OLED_ENABLE
 #include "oled_driver.h"
 #include "bodegafresh_logo.h"
+#include "oled_rle.h"
+#include "oled_tiles.h"
+#include "layer_icons.h"
+
+/* Íconos por capa (layer_icons.h, generado desde assets/layer_icons/).
+   Todos miden 32x16, así que cada uno tapa por completo al anterior. */
+static const uint8_t *const PROGMEM layer_icon_maps[] = {
+  [_BASE] = layer_icons_base_map,
+  [_SYM]  = layer_icons_sym_map,
+  [_NUM]  = layer_icons_num_map,
+  [_SYS]  = layer_icons_sys_map,
+  [_NAV]  = layer_icons_nav_map,
+  [_ACC]  = layer_icons_acc_map,
+};
+#define LAYER_ICON_COL  0
+#define LAYER_ICON_PAGE 2   // debajo del logo (páginas 2 y 3)
+
+/* Redibuja solo cuando cambia la capa más alta */
+static uint8_t icon_layer = 0xFF;
+static void draw_layer_icon(void) {
+  uint8_t layer = get_highest_layer(layer_state | default_layer_state);
+  if (layer == icon_layer || layer > _ACC) return;
+  oled_tiles_draw(layer_icons_tiles, pgm_read_ptr(&layer_icon_maps[layer]),
+                  LAYER_ICONS_BASE_W_TILES, LAYER_ICONS_BASE_H_PAGES, LAYER_ICON_COL, LAYER_ICON_PAGE);
+  icon_layer = layer;
+}
 
-static const char *layer_name(void) {
-  switch (get_highest_layer(layer_state | default_layer_state)) {
-    case _BASE: return "BASE";
-    case _SYM:  return "SYM";
-    case _NUM:  return "NUM";
-    case _SYS:  return "SYS";
-    case _NAV:  return "NAV";
-    default:    return "???";
-  }
+#ifdef SCAN_METER
+/* Scan rate a la derecha del ícono: "scan  1234/s" y "gap     12ms".
+   Solo escribe cuando scan_meter.c publica un valor distinto. */
+#define SCAN_METER_COL 6   // en caracteres de 6 px: después del ícono de 32 px
+static void draw_scan_meter(void) {
+  uint16_t rate, gap;
+  if (!scan_meter_changed(&rate, &gap)) return;
+  oled_set_cursor(SCAN_METER_COL, LAYER_ICON_PAGE);
+  oled_write_P(PSTR("scan"), false);
+  oled_write(get_u16_str(rate, ' '), false);
+  oled_write_P(PSTR("/s"), false);
+  oled_set_cursor(SCAN_METER_COL, LAYER_ICON_PAGE + 1);
+  oled_write_P(PSTR("gap "), false);
+  oled_write(get_u16_str(gap, ' '), false);
+  oled_write_P(PSTR("ms"), false);
 }
+#endif
 
-/* Dibuja el logo 112x16 en la esquina superior izquierda
-   y limpia el resto de las dos primeras páginas (16 px de alto). */
+/* Dibuja el logo 112x16 (RLE, 2 páginas con el relleno a 0) una sola vez:
+   el buffer del OLED conserva el contenido entre frames. */
+static bool logo_drawn = false;
 static void draw_bodegafresh_top(void) {
-  oled_clear();  // limpia TODO el buffer primero
-
-  // Escribir el bitmap (224 bytes) en (0,0)
-  const uint16_t LOGO_BYTES = (BODEGAFRESH_W * BODEGAFRESH_H) / 8;     // 112*16/8 = 224
-  for (uint16_t i = 0; i < LOGO_BYTES; i++) {
-    oled_write_raw_byte(pgm_read_byte(&bodegafresh_logo_112x16[i]), i);
-  }
-
-  // Rellenar con 0 el resto de las dos primeras páginas para evitar “ruido”
-  const uint16_t PAGE_BYTES = 128;                    // 128 columnas por página
-  const uint16_t TWO_PAGES  = PAGE_BYTES * 2;         // 16 px alto = 2 páginas
-  for (uint16_t i = LOGO_BYTES; i < TWO_PAGES; i++) {
-    oled_write_raw_byte(0x00, i);
-  }
+  if (logo_drawn) return;
+  oled_clear();
+  oled_rle_draw(bodegafresh_logo_rle, 0);
+  logo_drawn = true;
 }
 
 const char *read_logo(void);
@@ -240,16 +358,62 @@ void set_keylog(uint16_t keycode, keyrecord_t *record);
 const char *read_keylog(void);
 const char *read_keylogs(void);
 bool oled_task_user(void) {
+  if (idle_state() == IDLE_BLANK) return false;   // apagado: no ensuciar el buffer (render lo encendería)
+  PROF_START(PROF_OLED_TASK);
   if (is_keyboard_master()) {
     draw_bodegafresh_top();
-
-    // Texto abajo (desde y=16 px => fila 2)
-    oled_set_cursor(0, 2);                 // columna 0, fila 2 (cada fila = 8 px)
-    oled_write_P(PSTR("Layer: "), false);
-    oled_write(layer_name(), false);
+    draw_layer_icon();
+#ifdef SCAN_METER
+    draw_scan_meter();
+#endif
   } else {
     oled_write(read_logo(), false);
   }
+  PROF_STOP(PROF_OLED_TASK);
   return false;
 }
 #endif
+
+/* ──────────────────────────────────────────────────────────────
+ * Inicio y loop (ambas mitades)
+ * ────────────────────────────────────────────────────────────*/
+void keyboard_post_init_user(void){
+  symbol_table_init();
+  macro_delay_init();
+#ifdef PRESS_COUNT
+  press_count_init();
+#endif
+#ifdef RGBLIGHT_ENABLE
+  lighting_init();
+#endif
+  idle_init();
+}
+
+#ifdef SCAN_METER
+void matrix_scan_user(void){
+  scan_meter_task();
+}
+#endif
+
+void housekeeping_task_user(void){
+#ifdef HOTPATH_PROF
+  /* entre dos llamadas pasa una vuelta entera de keyboard_task() */
+  static uint16_t loop_t0;
+  uint16_t now = prof_now_us();
+  if (loop_t0) prof_record(PROF_LOOP, now - loop_t0);
+  loop_t0 = now;
+#endif
+  idle_task();
+#ifdef PRESS_COUNT
+  press_count_task();   // solo escribe la EEPROM en inactividad
+#endif
+  combo_hash_task();
+  leader_trie_task();
+  snippet_task();
+  accent_task();
+  macro_delay_task();
+#if defined(RGBLIGHT_ENABLE) && defined(RGB_BREATHE_LUT)
+  /* capa, mods y LEDs del host llegan por el split */
+  lighting_task();
+#endif
+}
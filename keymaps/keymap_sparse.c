@@ -0,0 +1,23 @@
+#include QMK_KEYBOARD_H
+#include "bodegafresh_keycodes.h"
+#include "keymap_sparse.h"
+
+/* ──────────────────────────────────────────────────────────────
+ * Keymap compacto (keymap_sparse.h, generado con keymap_sparse_gen.py)
+ *  Reemplaza la versión weak de QMK, que lee keymaps[] completo.
+ *  Va en su propio .c porque QMK incluye keymap.c dentro de
+ *  keymap_introspection.c, junto a la definición weak.
+ *  Transparente = 1 byte leído; resto = byte + popcount + 1 word.
+ * ────────────────────────────────────────────────────────────*/
+uint16_t keymap_sparse_index(uint8_t layer, uint8_t row, uint8_t col) {
+  if (layer >= KEYMAP_SPARSE_LAYERS || row >= MATRIX_ROWS || col >= MATRIX_COLS) return KEYMAP_SPARSE_CODES;
+  uint8_t bits = pgm_read_byte(&keymap_sparse_bits[layer][row]);
+  uint8_t bit  = 1 << col;
+  if (!(bits & bit)) return KEYMAP_SPARSE_CODES;
+  return keymap_sparse_read_base(&keymap_sparse_base[layer][row]) + __builtin_popcount(bits & (bit - 1));
+}
+
+uint16_t keycode_at_keymap_location(uint8_t layer, uint8_t row, uint8_t col) {
+  uint16_t idx = keymap_sparse_index(layer, row, col);
+  return idx < KEYMAP_SPARSE_CODES ? pgm_read_word(&keymap_sparse_codes[idx]) : KC_TRNS;
+}
@@ -0,0 +1,204 @@
+/* Generado por keymap_sparse_gen.py desde keymap.c. NO editar a mano. */
+#pragma once
+
+/* 6 capas, 164 teclas no transparentes: 448 bytes (vs 720 del arreglo completo) */
+#define KEYMAP_SPARSE_LAYERS 6
+#define KEYMAP_SPARSE_CODES  164
+#define KEYMAP_SPARSE_HASH   0xE741   // posiciones no transparentes (press_count.c)
+#define keymap_sparse_read_base(p) pgm_read_byte(p)
+
+/* keymap_sparse.c: índice en keymap_sparse_codes[]; KEYMAP_SPARSE_CODES = transparente */
+uint16_t keymap_sparse_index(uint8_t layer, uint8_t row, uint8_t col);
+
+/* bit c = columna c no transparente en esa fila */
+static const uint8_t PROGMEM keymap_sparse_bits[][MATRIX_ROWS] = {
+  [_BASE] = { 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E },
+  [_SYM] = { 0x3F, 0x3F, 0x3F, 0x0E, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x00 },
+  [_NUM] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x30 },
+  [_SYS] = { 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00 },
+  [_NAV] = { 0x3F, 0x00, 0x01, 0x01, 0x00, 0x3F, 0x3F, 0x3F, 0x00, 0x00 },
+  [_ACC] = { 0x00, 0x08, 0x02, 0x00, 0x00, 0x00, 0x1C, 0x10, 0x00, 0x00 },
+};
+
+/* índice en keymap_sparse_codes[] de la primera tecla de cada fila */
+static const uint8_t PROGMEM keymap_sparse_base[][MATRIX_ROWS] = {
+  [_BASE] = { 0, 6, 12, 18, 24, 29, 35, 41, 47, 53 },
+  [_SYM] = { 58, 64, 70, 76, 79, 79, 85, 91, 97, 97 },
+  [_NUM] = { 97, 97, 97, 97, 97, 97, 103, 109, 115, 121 },
+  [_SYS] = { 123, 123, 126, 129, 129, 129, 129, 129, 132, 132 },
+  [_NAV] = { 132, 138, 138, 139, 140, 140, 146, 152, 158, 158 },
+  [_ACC] = { 158, 158, 159, 160, 160, 160, 160, 163, 164, 164 },
+};
+
+static const uint16_t PROGMEM keymap_sparse_codes[KEYMAP_SPARSE_CODES] = {
+  /* _BASE */
+  KC_ESC, /* r0 c0 */
+  KC_1, /* r0 c1 */
+  KC_2, /* r0 c2 */
+  KC_3, /* r0 c3 */
+  KC_4, /* r0 c4 */
+  KC_5, /* r0 c5 */
+  KC_TAB, /* r1 c0 */
+  KC_Q, /* r1 c1 */
+  KC_W, /* r1 c2 */
+  KC_E, /* r1 c3 */
+  KC_R, /* r1 c4 */
+  KC_T, /* r1 c5 */
+  KC_LSFT, /* r2 c0 */
+  KC_A, /* r2 c1 */
+  KC_S, /* r2 c2 */
+  KC_D, /* r2 c3 */
+  KC_F, /* r2 c4 */
+  KC_G, /* r2 c5 */
+  KC_LCTL, /* r3 c0 */
+  KC_Z, /* r3 c1 */
+  KC_X, /* r3 c2 */
+  KC_C, /* r3 c3 */
+  KC_V, /* r3 c4 */
+  KC_B, /* r3 c5 */
+  KC_LALT, /* r4 c1 */
+  KC_LGUI, /* r4 c2 */
+  MO(_SYM), /* r4 c3 */
+  KC_SPC, /* r4 c4 */
+  KC_LBRC, /* r4 c5 */
+  KC_BSPC, /* r5 c0 */
+  KC_0, /* r5 c1 */
+  KC_9, /* r5 c2 */
+  KC_8, /* r5 c3 */
+  KC_7, /* r5 c4 */
+  KC_6, /* r5 c5 */
+  ASTER_SYM, /* r6 c0 */
+  KC_P, /* r6 c1 */
+  KC_O, /* r6 c2 */
+  KC_I, /* r6 c3 */
+  KC_U, /* r6 c4 */
+  KC_Y, /* r6 c5 */
+  KC_DEL, /* r7 c0 */
+  ES_NTIL, /* r7 c1 */
+  KC_L, /* r7 c2 */
+  KC_K, /* r7 c3 */
+  KC_J, /* r7 c4 */
+  KC_H, /* r7 c5 */
+  KC_RSFT, /* r8 c0 */
+  MINUS_UNDER, /* r8 c1 */
+  KC_DOT, /* r8 c2 */
+  KC_COMM, /* r8 c3 */
+  KC_M, /* r8 c4 */
+  KC_N, /* r8 c5 */
+  TG(_SYS), /* r9 c1 */
+  TG(_NUM), /* r9 c2 */
+  MO(_NAV), /* r9 c3 */
+  KC_ENT, /* r9 c4 */
+  KC_RBRC, /* r9 c5 */
+  /* _SYM */
+  SYM_BACKTICK, /* r0 c0 */
+  SYM_TILDE, /* r0 c1 */
+  SYM_LT, /* r0 c2 */
+  SYM_GT, /* r0 c3 */
+  SYM_LBRC, /* r0 c4 */
+  SYM_RBRC, /* r0 c5 */
+  SYM_INIT_A, /* r1 c0 */
+  BKTICK3_SYM, /* r1 c1 */
+  SQUO_SYM, /* r1 c2 */
+  DQUO_SYM, /* r1 c3 */
+  ASTER_SYM, /* r1 c4 */
+  KC_CAPS, /* r1 c5 */
+  SYM_CARET, /* r2 c0 */
+  SNIP_SHEBANG_SH, /* r2 c1 */
+  SNIP_SHEBANG_PY, /* r2 c2 */
+  SNIP_PY_MAIN, /* r2 c3 */
+  SNIP_PY_ARGPARSE, /* r2 c4 */
+  SNIP_FENCE_BASH, /* r2 c5 */
+  SNIP_INCLUDE_STD, /* r3 c1 */
+  SNIP_C_MAIN, /* r3 c2 */
+  LEADER_KEY, /* r3 c3 */
+  SYM_SLASH, /* r5 c0 */
+  SYM_AT, /* r5 c1 */
+  SYM_BSLS, /* r5 c2 */
+  SYM_PIPE, /* r5 c3 */
+  SYM_RCBR, /* r5 c4 */
+  SYM_LCBR, /* r5 c5 */
+  SYM_INIT_G, /* r6 c0 */
+  KC_EXLM, /* r6 c1 */
+  ES_IEXCL, /* r6 c2 */
+  ES_QUES, /* r6 c3 */
+  ES_IQUES, /* r6 c4 */
+  SYM_KC_COLN, /* r6 c5 */
+  MACRO_YAKU, /* r7 c0 */
+  SNIP_PRAGMA, /* r7 c1 */
+  SNIP_INCLUDE, /* r7 c2 */
+  SNIP_CONSOLE, /* r7 c3 */
+  SNIP_ARROW_ASYNC, /* r7 c4 */
+  SNIP_ARROW, /* r7 c5 */
+  /* _NUM */
+  XXXXXXX, /* r5 c0 */
+  ASTER_SYM, /* r5 c1 */
+  SLASH_SYM, /* r5 c2 */
+  KC_9, /* r5 c3 */
+  KC_8, /* r5 c4 */
+  KC_7, /* r5 c5 */
+  XXXXXXX, /* r6 c0 */
+  PLUS_SYM, /* r6 c1 */
+  MINUS_SYM, /* r6 c2 */
+  KC_6, /* r6 c3 */
+  KC_5, /* r6 c4 */
+  KC_4, /* r6 c5 */
+  XXXXXXX, /* r7 c0 */
+  KC_COMM, /* r7 c1 */
+  EQL_SYM, /* r7 c2 */
+  KC_3, /* r7 c3 */
+  KC_2, /* r7 c4 */
+  KC_1, /* r7 c5 */
+  XXXXXXX, /* r8 c0 */
+  XXXXXXX, /* r8 c1 */
+  XXXXXXX, /* r8 c2 */
+  KC_DOT, /* r8 c3 */
+  KC_0, /* r8 c4 */
+  XXXXXXX, /* r8 c5 */
+  KC_ENT, /* r9 c4 */
+  XXXXXXX, /* r9 c5 */
+  /* _SYS */
+  KC_VOLD, /* r1 c1 */
+  KC_MUTE, /* r1 c2 */
+  KC_VOLU, /* r1 c3 */
+  KC_MPRV, /* r2 c1 */
+  KC_MPLY, /* r2 c2 */
+  KC_MNXT, /* r2 c3 */
+  LGUI(KC_L), /* r7 c2 */
+  LSFT(LGUI(KC_S)), /* r7 c3 */
+  LGUI(KC_TAB), /* r7 c4 */
+  /* _NAV */
+  KC_F1, /* r0 c0 */
+  KC_F2, /* r0 c1 */
+  KC_F3, /* r0 c2 */
+  KC_F4, /* r0 c3 */
+  KC_F5, /* r0 c4 */
+  KC_F6, /* r0 c5 */
+  KC_LSFT, /* r2 c0 */
+  KC_LCTL, /* r3 c0 */
+  KC_F12, /* r5 c0 */
+  KC_F11, /* r5 c1 */
+  KC_F10, /* r5 c2 */
+  KC_F9, /* r5 c3 */
+  KC_F8, /* r5 c4 */
+  KC_F7, /* r5 c5 */
+  XXXXXXX, /* r6 c0 */
+  KC_END, /* r6 c1 */
+  KC_PGUP, /* r6 c2 */
+  KC_PGDN, /* r6 c3 */
+  KC_HOME, /* r6 c4 */
+  XXXXXXX, /* r6 c5 */
+  XXXXXXX, /* r7 c0 */
+  KC_RGHT, /* r7 c1 */
+  KC_UP, /* r7 c2 */
+  KC_DOWN, /* r7 c3 */
+  KC_LEFT, /* r7 c4 */
+  XXXXXXX, /* r7 c5 */
+  /* _ACC */
+  ES_EACU, /* r1 c3 */
+  ES_AACU, /* r2 c1 */
+  ES_OACU, /* r6 c2 */
+  ES_IACU, /* r6 c3 */
+  ES_UACU, /* r6 c4 */
+  ES_UDIA, /* r7 c4 */
+};
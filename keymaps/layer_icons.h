@@ -0,0 +1,79 @@
+/* Generado por oled_asset_compiler.py. NO editar a mano. */
+#pragma once
+#include <avr/pgmspace.h>
+
+/* 6 assets, 21 tiles únicos: 216 bytes (vs 384 sin deduplicar) */
+#define LAYER_ICONS_TILE_COUNT 21
+typedef uint8_t layer_icons_index_t;
+
+static const uint8_t PROGMEM layer_icons_tiles[][8] = {
+  { 0xFE, 0xFE, 0x02, 0x02, 0x02, 0xFE, 0xFC, 0x00 }, /* 0 */
+  { 0xF0, 0xFC, 0x0E, 0x02, 0x0E, 0xFC, 0xF0, 0x00 }, /* 1 */
+  { 0x3C, 0xFE, 0xC2, 0x02, 0x02, 0x0E, 0x0C, 0x00 }, /* 2 */
+  { 0xFE, 0xFE, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00 }, /* 3 */
+  { 0xFF, 0xFF, 0x81, 0x81, 0x81, 0xFF, 0x7E, 0x00 }, /* 4 */
+  { 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x00 }, /* 5 */
+  { 0x60, 0xE0, 0x81, 0x81, 0x87, 0xFE, 0x78, 0x00 }, /* 6 */
+  { 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x80, 0x00 }, /* 7 */
+  { 0x0E, 0x3E, 0xF0, 0xC0, 0xF0, 0x3E, 0x0E, 0x00 }, /* 8 */
+  { 0xFE, 0xFE, 0x3C, 0xF0, 0x3C, 0xFE, 0xFE, 0x00 }, /* 9 */
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, /* 10 */
+  { 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00 }, /* 11 */
+  { 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00 }, /* 12 */
+  { 0xFE, 0xFE, 0x3C, 0xF0, 0xC0, 0xFE, 0xFE, 0x00 }, /* 13 */
+  { 0xFE, 0xFE, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00 }, /* 14 */
+  { 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00 }, /* 15 */
+  { 0x7F, 0xFF, 0x80, 0x80, 0x80, 0xFF, 0x7F, 0x00 }, /* 16 */
+  { 0x01, 0x1F, 0x7E, 0xE0, 0x7E, 0x1F, 0x01, 0x00 }, /* 17 */
+  { 0xF0, 0xFC, 0x0E, 0x02, 0x0F, 0xFD, 0xF0, 0x00 }, /* 18 */
+  { 0xFC, 0xFE, 0x02, 0x02, 0x02, 0x0E, 0x0C, 0x00 }, /* 19 */
+  { 0x7F, 0xFF, 0x80, 0x80, 0x80, 0xE0, 0x60, 0x00 }, /* 20 */
+};
+
+/* layer_icons_base: 32x16 px (base.txt) */
+#define LAYER_ICONS_BASE_W_TILES 4
+#define LAYER_ICONS_BASE_H_PAGES 2
+static const layer_icons_index_t PROGMEM layer_icons_base_map[] = {
+  0, 1, 2, 3,
+  4, 5, 6, 7,
+};
+
+/* layer_icons_sym: 32x16 px (sym.txt) */
+#define LAYER_ICONS_SYM_W_TILES 4
+#define LAYER_ICONS_SYM_H_PAGES 2
+static const layer_icons_index_t PROGMEM layer_icons_sym_map[] = {
+  2, 8, 9, 10,
+  6, 11, 12, 10,
+};
+
+/* layer_icons_num: 32x16 px (num.txt) */
+#define LAYER_ICONS_NUM_W_TILES 4
+#define LAYER_ICONS_NUM_H_PAGES 2
+static const layer_icons_index_t PROGMEM layer_icons_num_map[] = {
+  13, 14, 9, 10,
+  15, 16, 12, 10,
+};
+
+/* layer_icons_sys: 32x16 px (sys.txt) */
+#define LAYER_ICONS_SYS_W_TILES 4
+#define LAYER_ICONS_SYS_H_PAGES 2
+static const layer_icons_index_t PROGMEM layer_icons_sys_map[] = {
+  2, 8, 2, 10,
+  6, 11, 6, 10,
+};
+
+/* layer_icons_nav: 32x16 px (nav.txt) */
+#define LAYER_ICONS_NAV_W_TILES 4
+#define LAYER_ICONS_NAV_H_PAGES 2
+static const layer_icons_index_t PROGMEM layer_icons_nav_map[] = {
+  13, 1, 14, 10,
+  15, 5, 17, 10,
+};
+
+/* layer_icons_acc: 32x16 px (acc.txt) */
+#define LAYER_ICONS_ACC_W_TILES 4
+#define LAYER_ICONS_ACC_H_PAGES 2
+static const layer_icons_index_t PROGMEM layer_icons_acc_map[] = {
+  18, 19, 19, 10,
+  5, 20, 20, 10,
+};
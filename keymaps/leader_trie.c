@@ -0,0 +1,53 @@
+#include QMK_KEYBOARD_H
+#include "leader_trie.h"
+#include "bodegafresh_keycodes.h"
+#include "leader_trie_data.h"
+
+static bool active = false;
+static leader_index_t state;
+static uint16_t last_key;
+
+bool leader_trie_active(void) {
+  return active;
+}
+
+/* hijo de 'state' por la tecla kc, o LEADER_EMPTY */
+static leader_index_t leader_next(uint8_t kc) {
+  if (kc < KC_A || kc > KC_SLSH) return LEADER_EMPTY;
+  leader_index_t base = pgm_read_byte(&leader_base[state]);
+  uint16_t t = base + (kc - KC_A + 1);
+  if (t >= LEADER_SIZE || pgm_read_byte(&leader_check[t]) != state) return LEADER_EMPTY;
+  return t;
+}
+
+bool leader_trie_process(uint16_t keycode, keyrecord_t *record) {
+  if (keycode == LEADER_KEY) {
+    if (record->event.pressed) {
+      active = true;
+      state = 0;
+      last_key = timer_read();
+    }
+    return false;
+  }
+  if (!active || !record->event.pressed) return true;
+  if (IS_MODIFIER_KEYCODE(keycode) || IS_QK_MOMENTARY(keycode) || IS_QK_TOGGLE_LAYER(keycode)) return true;
+
+  leader_index_t t = keycode <= QK_BASIC_MAX ? leader_next(keycode) : LEADER_EMPTY;
+  if (t == LEADER_EMPTY) {
+    active = false;
+    return false;
+  }
+  leader_index_t base = pgm_read_byte(&leader_base[t]);
+  if (base >= LEADER_LEAF) {
+    active = false;
+    leader_trie_matched_user(pgm_read_word(&leader_action[base - LEADER_LEAF]));
+  } else {
+    state = t;
+    last_key = timer_read();
+  }
+  return false;
+}
+
+void leader_trie_task(void) {
+  if (active && timer_elapsed(last_key) > LEADER_TIMEOUT) active = false;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include QMK_KEYBOARD_H
+
+/* ──────────────────────────────────────────────────────────────
+ *  Leader (leader_trie.c, trie de leader_gen.py)
+ *  LEADER_KEY y luego una secuencia de assets/leader.txt, p. ej.
+ *  g s -> git status. Cada tecla es un salto en el trie de doble
+ *  arreglo: base[] + check[], sin recorrer las secuencias.
+ *  - Una tecla fuera del trie cancela y se traga.
+ *  - Mods y teclas de capa pasan: se pueden usar en el medio.
+ *  - LEADER_TIMEOUT ms sin teclas cancela.
+ * ────────────────────────────────────────────────────────────*/
+#ifndef LEADER_TIMEOUT
+#  define LEADER_TIMEOUT 1000
+#endif
+
+bool leader_trie_process(uint16_t keycode, keyrecord_t *record);   // false: tecla consumida
+void leader_trie_task(void);                                        // housekeeping_task_user
+bool leader_trie_active(void);
+
+/* La secuencia terminó: el keymap ejecuta la acción (un keycode) */
+void leader_trie_matched_user(uint16_t keycode);
@@ -0,0 +1,33 @@
+/* Generado por leader_gen.py desde assets/leader.txt. NO editar a mano. */
+#pragma once
+#include <avr/pgmspace.h>
+
+typedef uint8_t leader_index_t;
+#define LEADER_SIZE  26
+#define LEADER_LEAF  0x80   // base[] de una hoja: LEADER_LEAF + acción
+#define LEADER_EMPTY 0xFF   // check[] de una posición libre
+
+static const leader_index_t PROGMEM leader_base[LEADER_SIZE] = {
+    0,   0,   0,   0,   0, 131, 132,   2, 136, 129,   0,   0,   0, 130, 133, 138,
+    7,   0, 134,   3, 137, 135, 139,   0,   0, 128,
+};
+
+static const leader_index_t PROGMEM leader_check[LEADER_SIZE] = {
+  255, 255, 255,   0, 255,   7,   7,   0,  16,   3, 255, 255, 255,   3,   7,  19,
+    0, 255,   7,   0,  16,   7,  19, 255, 255,   0,
+};
+
+static const uint16_t PROGMEM leader_action[12] = {
+  MACRO_YAKU,  // y
+  SNIP_INCLUDE_STD,  // c i
+  SNIP_C_MAIN,  // c m
+  SNIP_GIT_COMMIT,  // g c
+  SNIP_GIT_DIFF,  // g d
+  SNIP_GIT_LOG,  // g l
+  SNIP_GIT_PUSH,  // g p
+  SNIP_GIT_STATUS,  // g s
+  SNIP_PY_ARGPARSE,  // p a
+  SNIP_PY_MAIN,  // p m
+  LGUI(KC_L),  // s l
+  LSFT(LGUI(KC_S)),  // s s
+};
@@ -0,0 +1,57 @@
+#include QMK_KEYBOARD_H
+#include "macro_delay.h"
+#include "raw_hid_cmd.h"
+
+#define MACRO_DELAY_EE_MAGIC 0xD7
+
+static uint8_t delay_ms = MACRO_DELAY_DEFAULT;
+static uint16_t test_keycode = KC_NO;   // RAW_CMD_MACRO_RUN pendiente
+
+void macro_delay_init(void) {
+  uint8_t ee[MACRO_DELAY_EE_SIZE];
+  eeconfig_read_user_datablock(ee, MACRO_DELAY_EE_ADDR, sizeof ee);
+  /* EEPROM vacía o de otro firmware: el default, sin escribir */
+  if (ee[0] == MACRO_DELAY_EE_MAGIC && ee[1] <= MACRO_DELAY_MAX) delay_ms = ee[1];
+}
+
+uint8_t macro_delay(void) { return delay_ms; }
+
+void macro_delay_wait(void) {
+  wait_ms(delay_ms);
+}
+
+/* fuera de raw_hid_receive(): la respuesta sale antes de que la macro empiece a escribir */
+void macro_delay_task(void) {
+  if (test_keycode == KC_NO) return;
+  uint16_t kc = test_keycode;
+  test_keycode = KC_NO;
+  macro_delay_run_user(kc);
+}
+
+/* ---------- Raw HID (macro_delay.py) ---------- */
+uint8_t macro_delay_raw_hid(uint8_t *data, uint8_t length) {
+  uint8_t *out = data + 2;
+  switch (data[0]) {
+    case RAW_CMD_MACRO_DELAY:   // [ms o 0xFF] -> [ms, default]; solo RAM
+      if (data[1] != 0xFF) {
+        if (data[1] > MACRO_DELAY_MAX) return RAW_ERR_ARG;
+        delay_ms = data[1];
+      }
+      out[0] = delay_ms;
+      out[1] = MACRO_DELAY_DEFAULT;
+      return RAW_OK;
+    case RAW_CMD_MACRO_SAVE: {
+      const uint8_t ee[MACRO_DELAY_EE_SIZE] = { MACRO_DELAY_EE_MAGIC, delay_ms };
+      eeconfig_update_user_datablock(ee, MACRO_DELAY_EE_ADDR, sizeof ee);
+      out[0] = delay_ms;
+      return RAW_OK;
+    }
+    case RAW_CMD_MACRO_RUN: {   // [keycode (u16)]
+      uint16_t kc = data[1] | data[2] << 8;
+      if (kc == KC_NO || test_keycode != KC_NO) return RAW_ERR_ARG;
+      test_keycode = kc;
+      return RAW_OK;
+    }
+  }
+  return RAW_ERR_UNKNOWN;
+}
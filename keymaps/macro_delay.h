@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include QMK_KEYBOARD_H
+
+/* ──────────────────────────────────────────────────────────────
+ *  Espera entre toques de las macros (macro_delay.c)
+ *  - tap_once16() (```) y la completa de las teclas muertas (^)
+ *    esperan macro_delay() ms en vez de un 18 fijo.
+ *  - macro_delay.py la calibra con el host real: manda macros de
+ *    prueba por Raw HID, lee lo que escribe la terminal y busca
+ *    el mínimo que sigue saliendo bien; el valor queda en EEPROM.
+ * ────────────────────────────────────────────────────────────*/
+#ifndef MACRO_DELAY_DEFAULT
+#  define MACRO_DELAY_DEFAULT 18   // ms, sin calibrar
+#endif
+#define MACRO_DELAY_MAX 100
+
+/* EEPROM: últimos 2 bytes del bloque de usuario, [magic][ms]; symbol_table.c usa el principio */
+#define MACRO_DELAY_EE_SIZE 2
+#define MACRO_DELAY_EE_ADDR (EECONFIG_USER_DATA_SIZE - MACRO_DELAY_EE_SIZE)
+
+void macro_delay_init(void);                 // keyboard_post_init_user: EEPROM -> RAM
+uint8_t macro_delay(void);
+void macro_delay_wait(void);                 // wait_ms(macro_delay())
+void macro_delay_task(void);                 // housekeeping: corre la macro de prueba pendiente
+uint8_t macro_delay_raw_hid(uint8_t *data, uint8_t length);
+
+/* keymap.c: corre la macro de keycode como si se hubiera apretado (RAW_CMD_MACRO_RUN) */
+void macro_delay_run_user(uint16_t keycode);
@@ -0,0 +1,27 @@
+#include QMK_KEYBOARD_H
+#include "oled_driver.h"
+#include "oled_rle.h"
+
+/* ──────────────────────────────────────────────────────────────
+ *  RLE (ver oled_logo_rle.py):
+ *  - 2 bytes: largo descomprimido (little endian)
+ *  - ctrl < 0x80 : ctrl+1 bytes literales
+ *  - ctrl >= 0x80: 1 byte repetido ctrl-0x7E veces
+ *  Se llama una vez al iniciar; oled_write_raw_byte() ya marca
+ *  como sucios solo los bloques tocados.
+ * ────────────────────────────────────────────────────────────*/
+uint16_t oled_rle_draw(const uint8_t *rle, uint16_t start) {
+  uint16_t total = pgm_read_byte(rle) | (pgm_read_byte(rle + 1) << 8);
+  uint16_t i = start, end = start + total;
+  rle += 2;
+  while (i < end) {
+    uint8_t ctrl = pgm_read_byte(rle++);
+    if (ctrl < 0x80) {
+      for (uint8_t n = ctrl + 1; n && i < end; n--) oled_write_raw_byte(pgm_read_byte(rle++), i++);
+    } else {
+      uint8_t v = pgm_read_byte(rle++);
+      for (uint8_t n = ctrl - 0x7E; n && i < end; n--) oled_write_raw_byte(v, i++);
+    }
+  }
+  return total;
+}
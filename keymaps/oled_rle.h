@@ -0,0 +1,6 @@
+#pragma once
+#include <stdint.h>
+
+/* Descomprime un flujo RLE de oled_logo_rle.py en el buffer del OLED,
+   a partir del índice 'start' (128 bytes por página). Devuelve los bytes escritos. */
+uint16_t oled_rle_draw(const uint8_t *rle, uint16_t start);
@@ -0,0 +1,18 @@
+#include QMK_KEYBOARD_H
+#include "oled_driver.h"
+#include "oled_tiles.h"
+
+/* ──────────────────────────────────────────────────────────────
+ *  Tiles 8x8 (ver oled_asset_compiler.py): cada tile son 8 columnas
+ *  de una página, así que se copian tal cual al buffer (128 B/página).
+ * ────────────────────────────────────────────────────────────*/
+void oled_tiles_draw(const uint8_t (*tiles)[8], const uint8_t *map,
+                     uint8_t w_tiles, uint8_t h_pages, uint8_t col, uint8_t page) {
+  for (uint8_t p = 0; p < h_pages; p++) {
+    uint16_t dst = (uint16_t)(page + p) * OLED_DISPLAY_WIDTH + col;
+    for (uint8_t t = 0; t < w_tiles; t++) {
+      const uint8_t *tile = tiles[pgm_read_byte(map++)];
+      for (uint8_t x = 0; x < 8; x++) oled_write_raw_byte(pgm_read_byte(tile + x), dst++);
+    }
+  }
+}
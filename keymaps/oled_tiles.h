@@ -0,0 +1,8 @@
+#pragma once
+#include <stdint.h>
+
+/* Dibuja un asset de oled_asset_compiler.py (mapa de índices uint8_t a tiles de 8x8)
+   con su esquina superior izquierda en la columna 'col' y la página 'page'.
+   Índices de un byte: el compilador no genera más de 256 tiles por header. */
+void oled_tiles_draw(const uint8_t (*tiles)[8], const uint8_t *map,
+                     uint8_t w_tiles, uint8_t h_pages, uint8_t col, uint8_t page);
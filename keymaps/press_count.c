@@ -0,0 +1,139 @@
+#include QMK_KEYBOARD_H
+#include "eeprom.h"
+#include "press_count.h"
+#include "idle_manager.h"
+#include "raw_hid_cmd.h"
+#include "bodegafresh_keycodes.h"
+#include "keymap_sparse.h"
+
+/* EEPROM, desde el final de eeconfig: copias de [contadores][hash (u16)][secuencia].
+   Se escriben en ese orden: una copia con el hash bueno ya tiene todos sus contadores,
+   y entre las válidas gana la de secuencia más nueva. */
+#define PRESS_COUNT_EE_START  EECONFIG_SIZE
+#define PRESS_COUNT_HASH_POS  (2 * KEYMAP_SPARSE_CODES)
+#define PRESS_COUNT_SLOT_SIZE (PRESS_COUNT_HASH_POS + 3)
+#define PRESS_COUNT_SLOTS     ((E2END + 1 - PRESS_COUNT_EE_START) / PRESS_COUNT_SLOT_SIZE)
+#define PRESS_COUNT_IDLE      0xFFFF   // flush_pos: no se está guardando
+_Static_assert(PRESS_COUNT_SLOTS >= 2, "la EEPROM libre no alcanza para dos copias de los contadores");
+
+static uint16_t counts[KEYMAP_SPARSE_CODES];
+static uint8_t slot, seq;            // última copia completa y su secuencia
+static bool dirty;
+static uint16_t flush_pos = PRESS_COUNT_IDLE;
+
+static uint8_t *slot_addr(uint8_t s) {
+  return (uint8_t *)(uintptr_t)(PRESS_COUNT_EE_START + s * PRESS_COUNT_SLOT_SIZE);
+}
+
+static uint8_t next_slot(void) {
+  return slot + 1 < PRESS_COUNT_SLOTS ? slot + 1 : 0;
+}
+
+/* byte pos de la copia que se está guardando */
+static uint8_t image_byte(uint16_t pos) {
+  if (pos < PRESS_COUNT_HASH_POS) return ((const uint8_t *)counts)[pos];
+  if (pos < PRESS_COUNT_HASH_POS + 2) return (uint8_t)(KEYMAP_SPARSE_HASH >> (8 * (pos - PRESS_COUNT_HASH_POS)));
+  return seq + 1;
+}
+
+void press_count_init(void) {
+  bool found = false;
+  for (uint8_t s = 0; s < PRESS_COUNT_SLOTS; s++) {
+    uint8_t *p = slot_addr(s) + PRESS_COUNT_HASH_POS;
+    uint16_t hash = eeprom_read_byte(p) | eeprom_read_byte(p + 1) << 8;
+    uint8_t q = eeprom_read_byte(p + 2);
+    if (hash != KEYMAP_SPARSE_HASH || (found && (int8_t)(q - seq) <= 0)) continue;
+    slot = s;
+    seq = q;
+    found = true;
+  }
+  /* EEPROM vacía o de otro keymap: desde cero, sin escribir hasta la primera inactividad */
+  if (found) eeprom_read_block(counts, slot_addr(slot), sizeof counts);
+  else slot = PRESS_COUNT_SLOTS - 1;   // el primer guardado va a la copia 0
+}
+
+void press_count_hit(keyrecord_t *record) {
+  if (!record->event.pressed) return;
+  keypos_t key = record->event.key;
+  if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) return;   // combos de QMK, encoders
+#ifdef STRICT_LAYER_RELEASE
+  uint8_t layer = layer_switch_get_layer(key);       // sin cache: recorre las capas
+#else
+  uint8_t layer = read_source_layers_cache(key);     // QMK ya la resolvió al apretar
+#endif
+  uint16_t i = keymap_sparse_index(layer, key.row, key.col);
+  if (i >= KEYMAP_SPARSE_CODES || counts[i] == UINT16_MAX) return;
+  counts[i]++;
+  dirty = true;
+}
+
+/* Solo en inactividad y sin esperar a la EEPROM: a lo sumo un byte escrito por vuelta.
+   Una tecla corta el guardado; la copia a medias no vale y se rehace en la próxima. */
+void press_count_task(void) {
+  if (idle_state() == IDLE_ACTIVE) {
+    if (flush_pos != PRESS_COUNT_IDLE) {
+      flush_pos = PRESS_COUNT_IDLE;
+      dirty = true;
+    }
+    return;
+  }
+  if (flush_pos == PRESS_COUNT_IDLE) {
+    if (!dirty) return;
+    dirty = false;
+    flush_pos = 0;
+  }
+#ifdef eeprom_is_ready
+  if (!eeprom_is_ready()) return;   // la escritura anterior sigue en curso
+#endif
+  uint8_t *p = slot_addr(next_slot());
+  for (uint8_t n = 0; n < PRESS_COUNT_SCAN; n++, flush_pos++) {
+    if (flush_pos == PRESS_COUNT_SLOT_SIZE) {
+      slot = next_slot();
+      seq++;
+      flush_pos = PRESS_COUNT_IDLE;
+      return;
+    }
+    uint8_t b = image_byte(flush_pos);
+    if (eeprom_read_byte(p + flush_pos) != b) {
+      eeprom_write_byte(p + flush_pos++, b);
+      return;
+    }
+  }
+}
+
+/* ---------- Raw HID (press_heatmap.py) ---------- */
+#define COUNTS_PER_REPORT ((RAW_HID_DATA - 3) / 2)
+
+uint8_t press_count_raw_hid(uint8_t *data, uint8_t length) {
+  uint16_t index = data[1] | data[2] << 8;
+  uint8_t *out = data + 2;
+  switch (data[0]) {
+    case RAW_CMD_PRESS_INFO:
+      out[0] = KEYMAP_SPARSE_CODES & 0xFF;
+      out[1] = KEYMAP_SPARSE_CODES >> 8;
+      out[2] = KEYMAP_SPARSE_HASH & 0xFF;
+      out[3] = KEYMAP_SPARSE_HASH >> 8;
+      out[4] = KEYMAP_SPARSE_LAYERS;
+      out[5] = PRESS_COUNT_SLOTS;
+      out[6] = seq;
+      return RAW_OK;
+    case RAW_CMD_PRESS_READ: {
+      if (index >= KEYMAP_SPARSE_CODES) return RAW_ERR_ARG;
+      uint8_t n = KEYMAP_SPARSE_CODES - index < COUNTS_PER_REPORT ? KEYMAP_SPARSE_CODES - index : COUNTS_PER_REPORT;
+      out[0] = index & 0xFF;
+      out[1] = index >> 8;
+      out[2] = n;
+      for (uint8_t i = 0; i < n; i++) {
+        out[3 + 2 * i] = counts[index + i] & 0xFF;
+        out[4 + 2 * i] = counts[index + i] >> 8;
+      }
+      return RAW_OK;
+    }
+    case RAW_CMD_PRESS_RESET:   // la EEPROM se pone a cero en la próxima inactividad
+      memset(counts, 0, sizeof counts);
+      dirty = true;
+      if (flush_pos != PRESS_COUNT_IDLE) flush_pos = 0;   // la copia en curso, desde el principio
+      return RAW_OK;
+  }
+  return RAW_ERR_UNKNOWN;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include QMK_KEYBOARD_H
+
+/* ──────────────────────────────────────────────────────────────
+ *  Contadores de pulsaciones por tecla y capa (press_count.c)
+ *  - Un uint16_t por tecla no transparente de keymap_sparse.h,
+ *    con el mismo índice: la capa sale del source layers cache
+ *    de QMK, así que contar es un byte, un popcount y un ++.
+ *  - Se guardan en la EEPROM libre después de eeconfig, en un
+ *    anillo de PRESS_COUNT_SLOTS copias: cada guardado va a la
+ *    siguiente y el byte de secuencia se escribe último, así que
+ *    un corte a medias deja la copia anterior.
+ *  - Solo se escribe en inactividad (idle_manager.c), de a un
+ *    byte cuando la EEPROM está libre; una tecla lo interrumpe.
+ *  - press_heatmap.py los lee por Raw HID como mapa de calor.
+ * ────────────────────────────────────────────────────────────*/
+#ifndef PRESS_COUNT_SCAN
+#  define PRESS_COUNT_SCAN 32   // bytes comparados por housekeeping mientras se guarda
+#endif
+
+void press_count_init(void);                          // keyboard_post_init_user: EEPROM -> RAM
+void press_count_hit(keyrecord_t *record);            // process_record_user
+void press_count_task(void);                          // housekeeping_task_user, después de idle_task()
+uint8_t press_count_raw_hid(uint8_t *data, uint8_t length);
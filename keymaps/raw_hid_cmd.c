@@ -0,0 +1,53 @@
+#include QMK_KEYBOARD_H
+#include "raw_hid_cmd.h"
+#include "symbol_table.h"
+#include "macro_delay.h"
+#ifdef HOTPATH_PROF
+#  include "hotpath_prof.h"
+#endif
+#ifdef PRESS_COUNT
+#  include "press_count.h"
+#endif
+
+#ifdef RAW_ENABLE
+#include "raw_hid.h"
+
+/* Un solo raw_hid_receive() para todo el keymap: despacha por data[0] */
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+  uint8_t status = RAW_ERR_UNKNOWN;
+  switch (data[0]) {
+    case RAW_CMD_PING:
+      data[2] = RAW_HID_PROTOCOL;
+      status = RAW_OK;
+      break;
+#ifdef HOTPATH_PROF
+    case RAW_CMD_PROF_INFO:
+    case RAW_CMD_PROF_READ:
+    case RAW_CMD_PROF_RESET:
+      status = prof_raw_hid(data, length);
+      break;
+#endif
+    case RAW_CMD_SYM_INFO:
+    case RAW_CMD_SYM_GET:
+    case RAW_CMD_SYM_SET:
+    case RAW_CMD_SYM_RESET:
+    case RAW_CMD_SYM_PROFILE:
+      status = symbol_table_raw_hid(data, length);
+      break;
+    case RAW_CMD_MACRO_DELAY:
+    case RAW_CMD_MACRO_SAVE:
+    case RAW_CMD_MACRO_RUN:
+      status = macro_delay_raw_hid(data, length);
+      break;
+#ifdef PRESS_COUNT
+    case RAW_CMD_PRESS_INFO:
+    case RAW_CMD_PRESS_READ:
+    case RAW_CMD_PRESS_RESET:
+      status = press_count_raw_hid(data, length);
+      break;
+#endif
+  }
+  data[1] = status;
+  raw_hid_send(data, length);
+}
+#endif
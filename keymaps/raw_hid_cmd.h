@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ──────────────────────────────────────────────────────────────
+ *  Protocolo Raw HID del keymap (reportes de 32 bytes, ver raw_hid.py)
+ *   pedido:    [cmd, args...]
+ *   respuesta: [cmd, estado, datos...]
+ *  Cada módulo atiende su rango con un <módulo>_raw_hid(data, len)
+ *  que escribe la respuesta desde data[2] y devuelve el estado.
+ * ────────────────────────────────────────────────────────────*/
+#define RAW_HID_REPORT 32
+#define RAW_HID_DATA   (RAW_HID_REPORT - 2)
+
+enum raw_hid_cmd {
+  RAW_CMD_PING       = 0x01,   // -> [versión del protocolo]
+  RAW_CMD_PROF_INFO  = 0x10,   // -> [sondas, buckets, µs por tick (u16)]
+  RAW_CMD_PROF_READ  = 0x11,   // [sonda, parte] -> parte 0: resumen, 1: histograma
+  RAW_CMD_PROF_RESET = 0x12,
+  RAW_CMD_SYM_INFO   = 0x20,   // -> [símbolos, primer keycode (u16)]
+  RAW_CMD_SYM_GET    = 0x21,   // [índice, n] -> [índice, n, n x (tap, shifted)]
+  RAW_CMD_SYM_SET    = 0x22,   // [índice, tap (u16), shifted (u16)] -> RAM + EEPROM
+  RAW_CMD_SYM_RESET  = 0x23,   // vuelve a los defaults de symbol_table.c
+  RAW_CMD_SYM_PROFILE = 0x24,  // [perfil o 0xFF] -> [perfil activo, perfiles]
+  RAW_CMD_MACRO_DELAY = 0x30,  // [ms o 0xFF] -> [ms activo, default]; solo RAM
+  RAW_CMD_MACRO_SAVE  = 0x31,  // ms activo -> EEPROM
+  RAW_CMD_MACRO_RUN   = 0x32,  // [keycode (u16)] -> la macro corre en el próximo housekeeping
+  RAW_CMD_PRESS_INFO  = 0x40,  // -> [teclas (u16), hash del keymap (u16), capas, copias, secuencia]
+  RAW_CMD_PRESS_READ  = 0x41,  // [índice (u16)] -> [índice (u16), n, n x contador (u16)]
+  RAW_CMD_PRESS_RESET = 0x42,  // contadores a cero (EEPROM en la próxima inactividad)
+};
+
+enum raw_hid_status {
+  RAW_OK = 0,
+  RAW_ERR_UNKNOWN,             // comando no compilado en este firmware
+  RAW_ERR_ARG,
+};
+
+#define RAW_HID_PROTOCOL 1
@@ -0,0 +1,54 @@
+#include QMK_KEYBOARD_H
+#include "rgb_breathe.h"
+#include "rgb_breathe_table.h"
+
+#ifdef RGBLIGHT_ENABLE
+_Static_assert((RGB_BREATHE_SLOW_DIV & (RGB_BREATHE_SLOW_DIV - 1)) == 0, "RGB_BREATHE_SLOW_DIV debe ser potencia de 2");
+
+/* ──────────────────────────────────────────────────────────────
+ *  Breathing por tabla
+ *  - El paso sale de sync_timer: las dos mitades respiran en fase
+ *    sin mandar nada por el split.
+ *  - Inactivo (last_input_activity, con SPLIT_ACTIVITY_ENABLE
+ *    también en la esclava): el paso se redondea a múltiplos de
+ *    RGB_BREATHE_SLOW_DIV; congelado queda fijo a media curva.
+ *  - Un frame igual al anterior no se escribe: cada rgblight_setrgb()
+ *    es un bit-bang WS2812 con interrupciones apagadas.
+ *  - rgb_breathe_due(): el paso solo cambia cada RGB_BREATHE_STEP_MS,
+ *    así que entre bordes de paso no hace falta ni calcularlo.
+ * ────────────────────────────────────────────────────────────*/
+static uint8_t last_rgb[3];
+static bool written = false;
+static uint16_t step_start;   // sync_timer del último borde de paso
+
+bool rgb_breathe_due(void) {
+  return !written || (uint16_t)(sync_timer_read() - step_start) >= RGB_BREATHE_STEP_MS;
+}
+
+void rgb_breathe_invalidate(void) {
+  written = false;
+}
+
+void rgb_breathe_task(uint8_t color, bool frozen) {
+  if (color >= RGB_BREATHE_COLORS) color = RGB_BREATHE_BASE;
+
+  uint32_t now = sync_timer_read32();
+  step_start = now - now % RGB_BREATHE_STEP_MS;
+  uint8_t step;
+  if (frozen) {
+    step = RGB_BREATHE_STEPS / 4;   // subida a media curva
+  } else {
+    step = (now / RGB_BREATHE_STEP_MS) % RGB_BREATHE_STEPS;
+    if (last_input_activity_elapsed() >= RGB_BREATHE_SLOW_MS) step &= ~(RGB_BREATHE_SLOW_DIV - 1);
+  }
+
+  uint16_t v = pgm_read_byte(&rgb_breathe_curve[step]) + 1;
+  uint8_t rgb[3];
+  for (uint8_t i = 0; i < 3; i++) rgb[i] = (pgm_read_byte(&rgb_breathe_rgb[color][i]) * v) >> 8;
+  if (written && !memcmp(rgb, last_rgb, sizeof rgb)) return;
+
+  rgblight_setrgb(rgb[0], rgb[1], rgb[2]);
+  memcpy(last_rgb, rgb, sizeof rgb);
+  written = true;
+}
+#endif
@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Breathing por tabla (rgb_breathe_table.h). Se llama en cada vuelta del loop de
+   ambas mitades con el color de rgb_breathe_table.h; solo escribe los LEDs cuando
+   cambia el frame. 'frozen' (idle_manager.c) deja el brillo fijo: cero escrituras. */
+void rgb_breathe_task(uint8_t color, bool frozen);
+
+/* true si ya empezó otro paso de la curva (o nunca se escribió): antes de eso
+   rgb_breathe_task() daría el mismo frame, salvo que cambie el color */
+bool rgb_breathe_due(void);
+
+/* Los LEDs pueden no mostrar el último frame (suspend/wake, resync del split,
+   cambio de inactividad): el próximo rgb_breathe_task() escribe sí o sí */
+void rgb_breathe_invalidate(void);
+
+/* ms por paso de la curva: 128 x 60 ms = 7.7 s por ciclo, como BREATHING en QMK */
+#ifndef RGB_BREATHE_STEP_MS
+#  define RGB_BREATHE_STEP_MS 60
+#endif
+/* sin teclas por este tiempo: 1 de cada RGB_BREATHE_SLOW_DIV pasos (mismo ciclo) */
+#ifndef RGB_BREATHE_SLOW_MS
+#  define RGB_BREATHE_SLOW_MS 10000
+#endif
+#ifndef RGB_BREATHE_SLOW_DIV
+#  define RGB_BREATHE_SLOW_DIV 4
+#endif
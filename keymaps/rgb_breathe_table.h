@@ -0,0 +1,39 @@
+/* Generado por rgb_breathe_gen.py. NO editar a mano. */
+#pragma once
+#include <avr/pgmspace.h>
+
+#define RGB_BREATHE_STEPS 128
+
+/* brillo 28..180 (RGBLIGHT_LIMIT_VAL 180) */
+static const uint8_t PROGMEM rgb_breathe_curve[RGB_BREATHE_STEPS] = {
+   28,  30,  33,  35,  37,  40,  42,  45,  47,  50,  53,  55,  58,  61,  64,  66,
+   69,  72,  75,  78,  81,  84,  88,  91,  94,  97, 100, 103, 106, 110, 113, 116,
+  119, 122, 125, 128, 131, 134, 137, 140, 143, 145, 148, 151, 153, 156, 158, 160,
+  162, 164, 166, 168, 170, 171, 173, 174, 175, 176, 177, 178, 179, 179, 180, 180,
+  180, 180, 180, 179, 179, 178, 177, 176, 175, 174, 173, 171, 170, 168, 166, 164,
+  162, 160, 158, 156, 153, 151, 148, 145, 143, 140, 137, 134, 131, 128, 125, 122,
+  119, 116, 113, 110, 106, 103, 100,  97,  94,  91,  88,  84,  81,  78,  75,  72,
+   69,  66,  64,  61,  58,  55,  53,  50,  47,  45,  42,  40,  37,  35,  33,  30,
+};
+
+enum rgb_breathe_color {
+  RGB_BREATHE_BASE,
+  RGB_BREATHE_SYM,
+  RGB_BREATHE_NUM,
+  RGB_BREATHE_SYS,
+  RGB_BREATHE_NAV,
+  RGB_BREATHE_ACC,
+  RGB_BREATHE_CAPS,
+  RGB_BREATHE_COLORS
+};
+
+/* RGB con V=255; el firmware escala por la curva */
+static const uint8_t PROGMEM rgb_breathe_rgb[RGB_BREATHE_COLORS][3] = {
+  [RGB_BREATHE_BASE] = { 255, 255, 255 },  /* H 0 S 0 */
+  [RGB_BREATHE_SYM] = {   0,   0, 255 },  /* H 170 S 255 */
+  [RGB_BREATHE_NUM] = {   0, 255,   0 },  /* H 85 S 255 */
+  [RGB_BREATHE_SYS] = { 255,   0, 252 },  /* H 213 S 255 */
+  [RGB_BREATHE_NAV] = { 252, 255,   0 },  /* H 43 S 255 */
+  [RGB_BREATHE_ACC] = {   0, 252, 255 },  /* H 128 S 255 */
+  [RGB_BREATHE_CAPS] = { 255,   0,   0 },  /* H 0 S 255 */
+};
@@ -14,3 +14,86 @@ SRC +=  ./lib/rgb_state_reader.c \
         ./lib/layer_state_reader.c \
         ./lib/logo_reader.c \
         ./lib/keylogger.c
+
+# keymap compacto: regenerar keymap_sparse.h con keymap_sparse_gen.py al editar keymaps[]
+SRC += keymap_sparse.c
+
+# logo RLE (bodegafresh_logo.h generado con oled_logo_rle.py)
+SRC += oled_rle.c
+
+# íconos por capa (layer_icons.h generado con oled_asset_compiler.py)
+SRC += oled_tiles.c
+
+# build para simavr_bench.py (qmk compile ... -e SIMAVR_BENCH=yes): sin LTO para que
+# cada función medida conserve su símbolo
+ifeq ($(strip $(SIMAVR_BENCH)), yes)
+    LTO_ENABLE = no
+    OPT_DEFS += -DSIMAVR_BENCH
+endif
+
+# breathing por tabla (rgb_breathe_table.h generado con rgb_breathe_gen.py);
+# RGB_BREATHE_LUT = no vuelve al BREATHING de rgblight
+RGB_BREATHE_LUT ?= yes
+ifeq ($(strip $(RGB_BREATHE_LUT)), yes)
+    OPT_DEFS += -DRGB_BREATHE_LUT
+    SRC += rgb_breathe.c
+endif
+
+# inactividad: atenúa/apaga el OLED y congela el RGB en ambas mitades (idle_manager.c)
+SRC += idle_manager.c
+
+# tabla de símbolos en EEPROM, editable por Raw HID con symbol_table.py;
+# os_detection elige el perfil (LATAM de Linux, Windows o macOS) al enumerar
+SRC += symbol_table.c
+OS_DETECTION_ENABLE = yes
+
+# símbolos sostenidos: autorepeat y rollover como una tecla normal (symbol_hold.c)
+SRC += symbol_hold.c
+
+# vocales acentuadas en la capa ACC (SYM + NAV) y completa de ^ sin wait_ms (accent.c)
+SRC += accent.c
+
+# espera entre toques de las macros, calibrada con macro_delay.py (Raw HID + EEPROM)
+SRC += macro_delay.c
+
+# SEND_LATAM() y snippets con el perfil de símbolos activo; SEND_STRING() va por el mismo
+# camino (send_latam.h)
+SRC += send_latam.c
+
+# snippets comprimidos en PROGMEM (snippet_data.h generado con snippet_gen.py desde assets/snippets.txt)
+SRC += snippets.c
+
+# leader: secuencias de assets/leader.txt en un trie PROGMEM (leader_trie_data.h generado con leader_gen.py)
+SRC += leader_trie.c
+
+# combos de dos teclas con hash perfecto (combo_hash_data.h generado con combo_gen.py desde assets/combos.txt)
+SRC += combo_hash.c
+
+# Raw HID: un solo raw_hid_receive() que despacha por comando (raw_hid_cmd.c, raw_hid.py)
+RAW_ENABLE = yes
+SRC += raw_hid_cmd.c
+
+# perfilador de hot paths leído por Raw HID con hotpath_prof.py. Es para medir, no para el
+# uso diario (sondas en cada vuelta del loop): qmk compile ... -e HOTPATH_PROF=yes
+HOTPATH_PROF ?= no
+ifeq ($(strip $(HOTPATH_PROF)), yes)
+    OPT_DEFS += -DHOTPATH_PROF
+    SRC += hotpath_prof.c
+endif
+
+# scans/s y peor hueco entre scans en el OLED de la maestra (scan_meter.c), para diagnóstico:
+# qmk compile ... -e SCAN_METER=yes
+SCAN_METER ?= no
+ifeq ($(strip $(SCAN_METER)), yes)
+    OPT_DEFS += -DSCAN_METER
+    SRC += scan_meter.c
+endif
+
+# pulsaciones por tecla y capa, guardadas en inactividad en un anillo de EEPROM (press_count.c);
+# press_heatmap.py las lee por Raw HID. Cuesta 2 B de RAM por tecla de keymap_sparse.h y dos
+# copias del mismo tamaño en EEPROM, así que va apagado: qmk compile ... -e PRESS_COUNT=yes
+PRESS_COUNT ?= no
+ifeq ($(strip $(PRESS_COUNT)), yes)
+    OPT_DEFS += -DPRESS_COUNT
+    SRC += press_count.c
+endif
@@ -0,0 +1,46 @@
+#include QMK_KEYBOARD_H
+#include "scan_meter.h"
+
+/* ──────────────────────────────────────────────────────────────
+ *  Medidor de scan rate (SCAN_METER = yes en rules.mk)
+ *  - Cuenta scans y el hueco más largo entre dos seguidos.
+ *  - Cada SCAN_METER_WINDOW_MS publica scans/s y ese hueco; el
+ *    OLED solo se redibuja si alguno de los dos cambió.
+ *  - Resolución de 1 ms: sirve para ver trabas (un render, un
+ *    macro, un frame WS2812), no el costo de un scan normal.
+ * ────────────────────────────────────────────────────────────*/
+static uint16_t window_start, last_scan, scans, worst;
+static uint16_t shown_rate, shown_gap;
+static bool started = false, fresh = false;
+
+void scan_meter_task(void) {
+  uint16_t now = timer_read();
+  if (!started) {
+    window_start = last_scan = now;
+    started = true;
+  }
+  uint16_t gap = now - last_scan;
+  last_scan = now;
+  if (gap > worst) worst = gap;
+  scans++;
+
+  uint16_t elapsed = now - window_start;
+  if (elapsed < SCAN_METER_WINDOW_MS) return;
+  uint16_t rate = (uint32_t)scans * 1000 / elapsed;
+  if (rate != shown_rate || worst != shown_gap) {
+    shown_rate = rate;
+    shown_gap = worst;
+    fresh = true;
+  }
+  window_start = now;
+  scans = 0;
+  worst = 0;
+}
+
+bool scan_meter_changed(uint16_t *scans_per_s, uint16_t *worst_gap_ms) {
+  if (!fresh) return false;
+  fresh = false;
+  *scans_per_s = shown_rate;
+  *worst_gap_ms = shown_gap;
+  return true;
+}
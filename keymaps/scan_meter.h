@@ -0,0 +1,14 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Medidor del loop: scans por segundo y el peor hueco entre dos scans
+   de la última ventana. Se alimenta desde matrix_scan_user(). */
+#ifndef SCAN_METER_WINDOW_MS
+#  define SCAN_METER_WINDOW_MS 1000
+#endif
+
+void scan_meter_task(void);     // matrix_scan_user
+
+/* true (una vez) cuando cerró una ventana con valores distintos a la anterior */
+bool scan_meter_changed(uint16_t *scans_per_s, uint16_t *worst_gap_ms);
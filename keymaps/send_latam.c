@@ -0,0 +1,138 @@
+#include QMK_KEYBOARD_H
+#include "send_latam.h"
+#include "symbol_table.h"
+
+/* Qué escribe cada carácter imprimible (0x20..0x7E) en el perfil activo:
+   - 0: letra, dígito o espacio, igual en todos los perfiles (ascii_keycode())
+   - ASCII_SYM | índice: entrada de la tabla de símbolos, editable por Raw HID
+     (con ASCII_SHIFTED, su "shifted")
+   - PUNCT_*: signo que la tabla de símbolos no tiene, de punct_keys[] */
+#define ASCII_SYM     0x80
+#define ASCII_SHIFTED 0x40
+#define CH(c, v)      [(c) - 0x20] = (v)
+#define SYMBOL(kc)    (ASCII_SYM | ((kc) - SYMBOL_FIRST))
+_Static_assert(SYMBOL_COUNT <= ASCII_SHIFTED, "la tabla de símbolos no entra en ascii_class[]");
+
+enum { PUNCT_EXLM = 1, PUNCT_HASH, PUNCT_DLR, PUNCT_PERC, PUNCT_AMPR,
+       PUNCT_LPRN, PUNCT_RPRN, PUNCT_COMM, PUNCT_DOT, PUNCT_SCLN, PUNCT_COUNT = PUNCT_SCLN };
+
+static const uint8_t PROGMEM ascii_class[0x7F - 0x20] = {
+  CH('!',  PUNCT_EXLM),
+  CH('"',  SYMBOL(DQUO_SYM)),
+  CH('#',  PUNCT_HASH),
+  CH('$',  PUNCT_DLR),
+  CH('%',  PUNCT_PERC),
+  CH('&',  PUNCT_AMPR),
+  CH('\'', SYMBOL(SQUO_SYM)),
+  CH('(',  PUNCT_LPRN),
+  CH(')',  PUNCT_RPRN),
+  CH('*',  SYMBOL(ASTER_SYM)),
+  CH('+',  SYMBOL(PLUS_SYM)),
+  CH(',',  PUNCT_COMM),
+  CH('-',  SYMBOL(MINUS_SYM)),
+  CH('.',  PUNCT_DOT),
+  CH('/',  SYMBOL(SYM_SLASH)),
+  CH(':',  SYMBOL(SYM_KC_COLN)),
+  CH(';',  PUNCT_SCLN),
+  CH('<',  SYMBOL(SYM_LT)),
+  CH('=',  SYMBOL(EQL_SYM)),
+  CH('>',  SYMBOL(SYM_GT)),
+  CH('?',  SYMBOL(ES_QUES)),
+  CH('@',  SYMBOL(SYM_AT)),
+  CH('[',  SYMBOL(SYM_LBRC)),
+  CH('\\', SYMBOL(SYM_BSLS)),
+  CH(']',  SYMBOL(SYM_RBRC)),
+  CH('^',  SYMBOL(SYM_CARET)),
+  CH('_',  SYMBOL(MINUS_UNDER) | ASCII_SHIFTED),
+  CH('`',  SYMBOL(SYM_BACKTICK)),
+  CH('{',  SYMBOL(SYM_LCBR)),
+  CH('|',  SYMBOL(SYM_PIPE)),
+  CH('}',  SYMBOL(SYM_RCBR)),
+  CH('~',  SYMBOL(SYM_TILDE)),
+};
+#undef CH
+#undef SYMBOL
+
+/* signos fuera de la tabla de símbolos, por perfil (enum symbol_profile):
+   ! # $ % & ( ) , . ; */
+#define PUNCT_LATAM { S(KC_1), S(KC_3), S(KC_4), S(KC_5), S(KC_6), S(KC_8), S(KC_9), KC_COMM, KC_DOT, S(KC_COMM) }
+static const uint16_t PROGMEM punct_keys[SYMBOL_PROFILES][PUNCT_COUNT] = {
+  [SYMBOL_PROFILE_LATAM]     = PUNCT_LATAM,
+  [SYMBOL_PROFILE_US]        = { S(KC_1), S(KC_3), S(KC_4), S(KC_5), S(KC_7), S(KC_9), S(KC_0), KC_COMM, KC_DOT, KC_SCLN },
+  [SYMBOL_PROFILE_WIN_LATAM] = PUNCT_LATAM,
+  [SYMBOL_PROFILE_MAC_LATAM] = PUNCT_LATAM,
+};
+#undef PUNCT_LATAM
+
+static bool sending = false;
+static uint8_t saved_mods, saved_oneshot, held;
+
+static void hold_mods(uint8_t mods) {
+  if (mods == held) return;
+  set_mods(mods);
+  send_keyboard_report();
+  held = mods;
+}
+
+/* un keycode con mods (S(RALT(KC_1))): mods de 5 bits a los 8 del reporte */
+static void send_key(uint16_t kc) {
+  uint8_t m = QK_MODS_GET_MODS(kc);
+  hold_mods(m & 0x10 ? (m & 0x0F) << 4 : m);
+  register_code(QK_MODS_GET_BASIC_KEYCODE(kc));
+  unregister_code(QK_MODS_GET_BASIC_KEYCODE(kc));
+}
+
+static uint16_t ascii_keycode(uint8_t a) {
+  switch (a) {
+    case '\b': return KC_BSPC;
+    case '\t': return KC_TAB;
+    case '\n': return KC_ENT;
+    case 0x1B: return KC_ESC;
+    case ' ':  return KC_SPC;
+    case 0x7F: return KC_DEL;
+    case '0':  return KC_0;
+  }
+  if (a >= '1' && a <= '9') return KC_1 + (a - '1');
+  if (a >= 'a' && a <= 'z') return KC_A + (a - 'a');
+  if (a >= 'A' && a <= 'Z') return S(KC_A + (a - 'A'));
+  if (a < 0x20 || a > 0x7E) return KC_NO;
+  uint8_t cls = pgm_read_byte(&ascii_class[a - 0x20]);
+  if (cls & ASCII_SYM) return symbol_tap(SYMBOL_FIRST + (cls & (ASCII_SHIFTED - 1)), cls & ASCII_SHIFTED);
+  return cls ? pgm_read_word(&punct_keys[symbol_profile()][cls - 1]) : KC_NO;
+}
+
+void latam_send_char(char c) {
+  uint16_t kc = ascii_keycode((uint8_t)c);
+  if (kc == KC_NO) return;
+  if (!sending) {
+    /* como tap_clean(): los mods del usuario no se mezclan con el texto */
+    saved_mods = get_mods();
+    saved_oneshot = get_oneshot_mods();
+    clear_oneshot_mods();
+    held = saved_mods;
+    sending = true;
+  }
+  send_key(kc);
+  if (c == '^') {   // muerta: su "shifted" en la tabla la completa (KC_NO si ^ es directo)
+    uint16_t done = symbol_tap(SYM_CARET, true);
+    if (done != kc) send_key(done);
+  }
+}
+
+void latam_send_done(void) {
+  if (!sending) return;
+  hold_mods(saved_mods);
+  set_oneshot_mods(saved_oneshot);
+  sending = false;
+}
+
+void send_latam(const char *str) {
+  while (*str) latam_send_char(*str++);
+  latam_send_done();
+}
+
+void send_latam_P(const char *str) {
+  char c;
+  while ((c = pgm_read_byte(str++))) latam_send_char(c);
+  latam_send_done();
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include QMK_KEYBOARD_H
+
+/* ──────────────────────────────────────────────────────────────
+ *  Texto según el perfil de símbolos activo (send_latam.c)
+ *  - SEND_LATAM() y los snippets escriben cada signo con la tabla
+ *    de símbolos (symbol_tap()): siguen el perfil del host y los
+ *    cambios hechos por Raw HID. Letras y dígitos son iguales en
+ *    todos los perfiles; ! # $ % & ( ) , . ; van por perfil.
+ *  - Deja Shift/AltGr apretados mientras los caracteres seguidos
+ *    los compartan: 2 reportes por carácter en vez de hasta 6,
+ *    más uno por cada cambio de modificadores.
+ *  - SEND_STRING() en el keymap es SEND_LATAM(): un solo camino
+ *    de texto, así el mismo carácter sale con la misma tecla en
+ *    macros y snippets.
+ * ────────────────────────────────────────────────────────────*/
+void latam_send_char(char c);        // mantiene los mods entre caracteres
+void latam_send_done(void);          // suelta y restaura los mods del usuario
+void send_latam(const char *str);
+void send_latam_P(const char *str);
+
+#define SEND_LATAM(str) send_latam_P(PSTR(str))
+
+/* reemplaza al de QMK (send_string.h), que tipea con las tablas de US */
+#ifdef SEND_STRING
+#  undef SEND_STRING
+#endif
+#define SEND_STRING(str) SEND_LATAM(str)
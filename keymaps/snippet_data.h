@@ -0,0 +1,94 @@
+/* Generado por snippet_gen.py desde assets/snippets.txt. NO editar a mano. */
+#pragma once
+#include <avr/pgmspace.h>
+
+#define SNIPPET_COUNT 17
+#define SNIPPET_STACK 4   // altura máxima de la pila al expandir
+
+/* código 0x80 + i -> par de símbolos (ASCII o código) */
+static const uint8_t PROGMEM snippet_dict[30][2] = {
+  { 0x69, 0x6e },  /* #0 = i n */
+  { 0x61, 0x72 },  /* #1 = a r */
+  { 0x74, 0x20 },  /* #2 = t ' ' */
+  { 0x28, 0x29 },  /* #3 = ( ) */
+  { 0x69, 0x82 },  /* #4 = i #2 */
+  { 0x20, 0x3d },  /* #5 = ' ' = */
+  { 0x67, 0x84 },  /* #6 = g #4 */
+  { 0x81, 0x67 },  /* #7 = #1 g */
+  { 0x20, 0x2d },  /* #8 = ' ' - */
+  { 0x5f, 0x5f },  /* #9 = _ _ */
+  { 0x6d, 0x61 },  /* #10 = m a */
+  { 0x6f, 0x6e },  /* #11 = o n */
+  { 0x73, 0x65 },  /* #12 = s e */
+  { 0x75, 0x73 },  /* #13 = u s */
+  { 0x20, 0x3c },  /* #14 = ' ' < */
+  { 0x20, 0x7b },  /* #15 = ' ' { */
+  { 0x23, 0x80 },  /* #16 = # #0 */
+  { 0x61, 0x73 },  /* #17 = a s */
+  { 0x63, 0x6c },  /* #18 = c l */
+  { 0x64, 0x65 },  /* #19 = d e */
+  { 0x65, 0x6e },  /* #20 = e n */
+  { 0x68, 0x0a },  /* #21 = h \n */
+  { 0x73, 0x74 },  /* #22 = s t */
+  { 0x75, 0x93 },  /* #23 = u #19 */
+  { 0x81, 0x8c },  /* #24 = #1 #12 */
+  { 0x83, 0x0a },  /* #25 = #3 \n */
+  { 0x8a, 0x80 },  /* #26 = #10 #0 */
+  { 0x90, 0x92 },  /* #27 = #16 #18 */
+  { 0x97, 0x8e },  /* #28 = #23 #14 */
+  { 0x9b, 0x9c },  /* #29 = #27 #28 */
+};
+
+static const uint8_t PROGMEM snippet_data[257] = {
+  /* ARROW: () => {} */
+  0x83, 0x85, 0x3e, 0x8f, 0x7d,
+  /* ARROW_ASYNC: async () => {} */
+  0x91, 0x79, 0x6e, 0x63, 0x20, 0x83, 0x85, 0x3e, 0x8f, 0x7d,
+  /* CONSOLE: console.log(); */
+  0x63, 0x8b, 0x73, 0x6f, 0x6c, 0x65, 0x2e, 0x6c, 0x6f, 0x67, 0x83, 0x3b,
+  /* INCLUDE: #include <> */
+  0x9d, 0x3e,
+  /* INCLUDE_STD: #include <stdint.h>\n#include <stdbool.h>\n */
+  0x9d, 0x96, 0x64, 0x80, 0x74, 0x2e, 0x68, 0x3e, 0x0a, 0x9d, 0x96, 0x64,
+  0x62, 0x6f, 0x6f, 0x6c, 0x2e, 0x68, 0x3e, 0x0a,
+  /* PRAGMA: #pragma once\n */
+  0x23, 0x70, 0x72, 0x61, 0x67, 0x8a, 0x20, 0x8b, 0x63, 0x65, 0x0a,
+  /* C_MAIN: int main(int argc, char **argv) {\n */
+  0x80, 0x82, 0x9a, 0x28, 0x80, 0x82, 0x87, 0x63, 0x2c, 0x20, 0x63, 0x68,
+  0x81, 0x20, 0x2a, 0x2a, 0x87, 0x76, 0x29, 0x8f, 0x0a,
+  /* SHEBANG_SH: #!/usr/bin/env bash\nset -euo pipefail\n */
+  0x23, 0x21, 0x2f, 0x8d, 0x72, 0x2f, 0x62, 0x80, 0x2f, 0x94, 0x76, 0x20,
+  0x62, 0x91, 0x95, 0x8c, 0x82, 0x2d, 0x65, 0x75, 0x6f, 0x20, 0x70, 0x69,
+  0x70, 0x65, 0x66, 0x61, 0x69, 0x6c, 0x0a,
+  /* SHEBANG_PY: #!/usr/bin/env python3\n# -*- coding: utf-8 -*-\n */
+  0x23, 0x21, 0x2f, 0x8d, 0x72, 0x2f, 0x62, 0x80, 0x2f, 0x94, 0x76, 0x20,
+  0x70, 0x79, 0x74, 0x68, 0x8b, 0x33, 0x0a, 0x23, 0x88, 0x2a, 0x2d, 0x20,
+  0x63, 0x6f, 0x64, 0x80, 0x67, 0x3a, 0x20, 0x75, 0x74, 0x66, 0x2d, 0x38,
+  0x88, 0x2a, 0x2d, 0x0a,
+  /* PY_MAIN: if __name__ == "__main__":\n    main()\n */
+  0x69, 0x66, 0x20, 0x89, 0x6e, 0x61, 0x6d, 0x65, 0x89, 0x85, 0x3d, 0x20,
+  0x22, 0x89, 0x9a, 0x89, 0x22, 0x3a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x9a,
+  0x99,
+  /* PY_ARGPARSE: ap = argparse.ArgumentParser()\nargs = ap.parse_args()\n */
+  0x61, 0x70, 0x85, 0x20, 0x87, 0x70, 0x98, 0x2e, 0x41, 0x72, 0x67, 0x75,
+  0x6d, 0x94, 0x74, 0x50, 0x98, 0x72, 0x99, 0x87, 0x73, 0x85, 0x20, 0x61,
+  0x70, 0x2e, 0x70, 0x98, 0x5f, 0x87, 0x73, 0x99,
+  /* FENCE_BASH: ```bash\n */
+  0x60, 0x60, 0x60, 0x62, 0x91, 0x95,
+  /* GIT_STATUS: git status\n */
+  0x86, 0x96, 0x61, 0x74, 0x8d, 0x0a,
+  /* GIT_DIFF: git diff\n */
+  0x86, 0x64, 0x69, 0x66, 0x66, 0x0a,
+  /* GIT_LOG: git log --oneline -20\n */
+  0x86, 0x6c, 0x6f, 0x67, 0x88, 0x2d, 0x8b, 0x65, 0x6c, 0x80, 0x65, 0x88,
+  0x32, 0x30, 0x0a,
+  /* GIT_COMMIT: git commit -m "" */
+  0x86, 0x63, 0x6f, 0x6d, 0x6d, 0x84, 0x2d, 0x6d, 0x20, 0x22, 0x22,
+  /* GIT_PUSH: git push\n */
+  0x86, 0x70, 0x8d, 0x95,
+};
+
+static const uint16_t PROGMEM snippet_offset[SNIPPET_COUNT + 1] = {
+  0, 5, 15, 27, 29, 49, 60, 81, 112, 152, 177, 209,
+  215, 221, 227, 242, 253, 257,
+};
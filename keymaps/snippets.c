@@ -0,0 +1,65 @@
+#include QMK_KEYBOARD_H
+#include "snippets.h"
+#include "send_latam.h"
+#include "snippet_data.h"
+
+_Static_assert(SNIPPET_LAST - SNIPPET_FIRST + 1 == SNIPPET_COUNT,
+               "snippet_data.h desactualizado: python3 snippet_gen.py");
+
+#define SNIPPET_CODE 0x80   // bytes >= 0x80: par de snippet_dict[]
+
+/* cola circular de snippets pendientes */
+static uint8_t queue[SNIPPET_QUEUE], head, pending;
+
+/* snippet en curso: posición en snippet_data[] y pila de códigos por expandir */
+static uint16_t pos, end;
+static uint8_t stack[SNIPPET_STACK], depth;
+static bool active = false;
+
+bool snippet_queue(uint16_t keycode) {
+  if (keycode < SNIPPET_FIRST || keycode > SNIPPET_LAST) return false;
+  if (pending < SNIPPET_QUEUE) {
+    queue[(head + pending) % SNIPPET_QUEUE] = keycode - SNIPPET_FIRST;
+    pending++;
+  }
+  return true;
+}
+
+bool snippet_busy(void) {
+  return active || pending;
+}
+
+/* siguiente carácter del snippet en curso, o 0 al terminar */
+static char snippet_next(void) {
+  for (;;) {
+    uint8_t b;
+    if (depth) b = stack[--depth];
+    else if (pos < end) b = pgm_read_byte(&snippet_data[pos++]);
+    else return 0;
+    if (b < SNIPPET_CODE) return b;
+    stack[depth++] = pgm_read_byte(&snippet_dict[b - SNIPPET_CODE][1]);
+    stack[depth++] = pgm_read_byte(&snippet_dict[b - SNIPPET_CODE][0]);
+  }
+}
+
+void snippet_task(void) {
+  if (!active) {
+    if (!pending) return;
+    uint8_t id = queue[head];
+    head = (head + 1) % SNIPPET_QUEUE;
+    pending--;
+    pos = pgm_read_word(&snippet_offset[id]);
+    end = pgm_read_word(&snippet_offset[id + 1]);
+    depth = 0;
+    active = true;
+  }
+  for (uint8_t i = 0; i < SNIPPET_BURST; i++) {
+    char c = snippet_next();
+    if (!c) {
+      active = false;
+      break;
+    }
+    latam_send_char(c);
+  }
+  latam_send_done();
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "bodegafresh_keycodes.h"
+
+/* ──────────────────────────────────────────────────────────────
+ *  Snippets de texto (snippets.c, datos de snippet_gen.py)
+ *  - El texto vive comprimido en PROGMEM (snippet_data.h) y se
+ *    expande de a un carácter, sin buffer del snippet entero.
+ *  - Apretar un SNIP_* solo lo encola; snippet_task() manda hasta
+ *    SNIPPET_BURST caracteres por vuelta del loop con
+ *    latam_send_char(), así el scan no se congela.
+ *  - Entre ráfagas se devuelven los mods del usuario: lo que se
+ *    apriete mientras sale el texto no queda mezclado con él.
+ * ────────────────────────────────────────────────────────────*/
+#define SNIPPET_FIRST SNIP_ARROW
+#define SNIPPET_LAST  SNIP_GIT_PUSH
+
+#ifndef SNIPPET_BURST
+#  define SNIPPET_BURST 4    // caracteres por vuelta: ~2 reportes HID cada uno
+#endif
+#ifndef SNIPPET_QUEUE
+#  define SNIPPET_QUEUE 4    // snippets pendientes; el resto se descarta
+#endif
+
+bool snippet_queue(uint16_t keycode);   // process_record_user
+void snippet_task(void);                // housekeeping_task_user
+bool snippet_busy(void);
@@ -0,0 +1,96 @@
+#include QMK_KEYBOARD_H
+#include "symbol_hold.h"
+#include "symbol_table.h"
+
+typedef struct {
+  uint16_t keycode;   // SYM_*/ES_*/operador; KC_NO = libre
+  uint16_t sent;      // lo que se registró (symbol_tap() al apretar)
+} held_symbol_t;
+
+static held_symbol_t held[SYMBOL_HOLD_SLOTS];
+static uint8_t held_count, hidden_mods;
+static uint16_t newest;   // último símbolo apretado: los weak mods son los suyos
+
+/* mods de un keycode con mods (S(), RALT(), ...) en el formato de get_mods() */
+static uint8_t keycode_mods(uint16_t kc) {
+  uint8_t m = QK_MODS_GET_MODS(kc);
+  return m & 0x10 ? (m & 0x0F) << 4 : m;
+}
+
+/* deja el próximo reporte con los mods justos de kc y aprieta la tecla: un reporte */
+static void override_press(uint16_t kc) {
+  uint8_t want = keycode_mods(kc), mods = get_mods();
+  hidden_mods |= mods & ~want;
+  del_mods(mods & ~want);
+  set_weak_mods(want & ~mods);
+  clear_oneshot_mods();
+  register_code(QK_MODS_GET_BASIC_KEYCODE(kc));
+}
+
+/* suelta la tecla; con restore, los mods del usuario vuelven en el mismo reporte */
+static void override_release(uint16_t kc, bool weak, bool restore) {
+  if (weak) clear_weak_mods();
+  if (restore) {
+    add_mods(hidden_mods);
+    hidden_mods = 0;
+  }
+  unregister_code(QK_MODS_GET_BASIC_KEYCODE(kc));
+}
+
+void symbol_send(uint16_t kc) {
+  if (kc == KC_NO) return;
+  override_press(kc);
+  override_release(kc, true, !held_count);
+}
+
+static held_symbol_t *find_slot(uint16_t keycode) {
+  for (uint8_t i = 0; i < SYMBOL_HOLD_SLOTS; i++)
+    if (held[i].keycode == keycode) return &held[i];
+  return NULL;
+}
+
+static void release(held_symbol_t *slot) {
+  bool last = newest == slot->keycode;
+  held_count--;
+  override_release(slot->sent, last, !held_count);
+  if (last) newest = KC_NO;
+  slot->keycode = KC_NO;
+}
+
+bool symbol_hold_process(uint16_t keycode, keyrecord_t *record) {
+  bool symbol = keycode >= SYMBOL_FIRST && keycode <= SYMBOL_LAST && keycode != SYM_CARET;
+
+  if (!record->event.pressed) {
+    if (IS_MODIFIER_KEYCODE(keycode)) hidden_mods &= ~MOD_BIT(keycode);   // ya no hay que devolverlo
+    held_symbol_t *slot = symbol ? find_slot(keycode) : NULL;
+    if (!slot) return true;
+    release(slot);
+    return false;
+  }
+
+  /* otra tecla (letra o mod real): en su propio reporte vuelven los mods del usuario
+     y se van los weak del símbolo, que si no se pegan a ella ("@h" daría AltGr+H).
+     El símbolo sigue apretado, pero el host repite la última tecla */
+  if (!symbol) {
+    if (!hidden_mods && newest == KC_NO) return true;
+    add_mods(hidden_mods);
+    hidden_mods = 0;
+    clear_weak_mods();
+    newest = KC_NO;   // su suelta ya no tiene weak mods que limpiar
+    send_keyboard_report();
+    return true;
+  }
+
+  held_symbol_t *slot = find_slot(keycode);     // misma tecla en otra capa: se re-aprieta
+  if (slot) release(slot);
+  slot = find_slot(KC_NO);
+  if (!slot) return true;                       // sin lugar: toque de process_record_keymap()
+
+  uint16_t sent = symbol_tap(keycode, (get_mods() | get_oneshot_mods()) & MOD_MASK_SHIFT);
+  if (sent == KC_NO) return false;
+  override_press(sent);
+  slot->keycode = newest = keycode;
+  slot->sent = sent;
+  held_count++;
+  return false;
+}
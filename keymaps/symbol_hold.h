@@ -0,0 +1,31 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include QMK_KEYBOARD_H
+
+/* ──────────────────────────────────────────────────────────────
+ *  Símbolos sostenidos y overrides de Shift (symbol_hold.c)
+ *  La tabla declarativa es symbol_table.c: cada tecla dice qué
+ *  manda sola y qué manda con Shift (ñ/Ñ, -/_ ...), por perfil.
+ *  - Las teclas se registran al apretar y se sueltan al soltar:
+ *    el host hace autorepeat y "->" o "*=" se solapan en orden.
+ *  - Los mods del reporte quedan exactamente en los que pide el
+ *    keycode traducido (Shift y one-shot incluidos): se esconden
+ *    los del usuario que sobran y se agregan como weak los que
+ *    faltan, todo en el mismo reporte que la tecla. Otra tecla
+ *    que no es símbolo los devuelve y limpia los weak antes de
+ *    su propio reporte.
+ *  - La suelta manda el keycode guardado al apretar, aunque
+ *    Shift o el perfil cambien en el medio, y en ese mismo
+ *    reporte vuelven los mods del usuario.
+ *  - SYM_CARET sigue siendo un toque (tecla muerta + espacio).
+ * ────────────────────────────────────────────────────────────*/
+#ifndef SYMBOL_HOLD_SLOTS
+#  define SYMBOL_HOLD_SLOTS 4   // símbolos apretados a la vez; el resto va como toque
+#endif
+
+bool symbol_hold_process(uint16_t keycode, keyrecord_t *record);   // false: tecla consumida
+
+/* Toque de un keycode básico con mods: 2 reportes (apretar y soltar) con los mods
+   justos; tap_clean() del keymap (^, leader, combos) */
+void symbol_send(uint16_t kc);
@@ -0,0 +1,297 @@
+#include QMK_KEYBOARD_H
+#include "symbol_table.h"
+#include "raw_hid_cmd.h"
+#include "macro_delay.h"
+
+/* SYM_CARET es tecla muerta: su "shifted" es la tecla que la completa
+   (KC_NO si el layout tiene ^ directo). SYM_ACUTE/SYM_DIAER son las muertas
+   que accent.c compone con la vocal (KC_NO: el layout no las tiene) */
+#define SYM(kc, ...) [(kc) - SYMBOL_FIRST] = { __VA_ARGS__ }
+
+/* Defaults ES-LATAM (según tu XKB); los comentarios son los de la distro */
+static const symbol_t PROGMEM symbol_latam[SYMBOL_COUNT] = {
+  /* letras/signos ES */
+  SYM(ES_NTIL,      KC_SCLN, S(KC_SCLN)),    // ñ / Ñ
+  SYM(ES_NTIL_CAP,  S(KC_SCLN)),
+  SYM(ES_IQUES,     KC_EQL),                 // ¿
+  SYM(ES_IEXCL,     S(RALT(KC_1))),          // ¡
+  SYM(ES_QUES,      S(KC_MINS)),             // ?
+
+  /* fila SYM */
+  SYM(SYM_BACKTICK, RALT(KC_NUHS)),          // `  (también BKTICK3_SYM)
+  SYM(SYM_TILDE,    RALT(KC_4)),             // ~
+  SYM(SYM_LT,       KC_NUBS),                // <
+  SYM(SYM_GT,       S(KC_NUBS)),             // >
+  SYM(SYM_LBRC,     RALT(KC_8)),             // [
+  SYM(SYM_RBRC,     RALT(KC_9)),             // ]  (o RALT(KC_0) según distro)
+  SYM(SYM_LCBR,     RALT(KC_7)),             // {
+  SYM(SYM_RCBR,     RALT(KC_0)),             // }  (o RALT(S(KC_0)))
+  SYM(SYM_PIPE,     RALT(KC_1)),             // |
+  SYM(SYM_BSLS,     RALT(KC_MINS)),          // (\)
+  SYM(SYM_AT,       RALT(KC_Q)),             // @
+  SYM(SYM_SLASH,    S(KC_7)),                // /
+  SYM(SYM_INIT_A,   RALT(KC_GRV)),           // ¬
+  SYM(SYM_INIT_G,   S(KC_GRV)),              // °
+  SYM(SYM_KC_COLN,  S(KC_DOT)),              // :
+  SYM(SYM_CARET,    RALT(KC_LBRC), KC_SPC),  // ^  dead_circumflex + espacio
+
+  /* muertas de la capa ACC, a la derecha de la P como en xkb latam. Si en tu XKB esa
+     tecla es ' (SQUO_SYM), mové las muertas con symbol_table.py set SYM_ACUTE ... */
+  SYM(SYM_ACUTE,    KC_LBRC),                // ´  muerta
+  SYM(SYM_DIAER,    S(KC_LBRC)),             // ¨  muerta
+
+  /* operadores */
+  SYM(EQL_SYM,      S(KC_0)),                // =
+  SYM(MINUS_SYM,    KC_SLSH),                // -
+  SYM(SLASH_SYM,    S(KC_7)),                // /
+  SYM(ASTER_SYM,    KC_KP_ASTERISK),         // *
+  SYM(PLUS_SYM,     KC_KP_PLUS),             // +
+  SYM(MINUS_UNDER,  KC_SLSH, S(KC_SLSH)),    // - / _
+
+  /* comillas */
+  SYM(DQUO_SYM,     RALT(KC_LBRC)),          // "
+  SYM(SQUO_SYM,     KC_LBRC),                // '
+};
+
+/* US (QWERTY ANSI): sin ñ ¿ ¡ ° ¬; esas teclas no envían nada */
+static const symbol_t PROGMEM symbol_us[SYMBOL_COUNT] = {
+  SYM(ES_NTIL,      KC_NO),
+  SYM(ES_NTIL_CAP,  KC_NO),
+  SYM(ES_IQUES,     KC_NO),
+  SYM(ES_IEXCL,     KC_NO),
+  SYM(ES_QUES,      S(KC_SLSH)),             // ?
+
+  SYM(SYM_BACKTICK, KC_GRV),                 // `
+  SYM(SYM_TILDE,    S(KC_GRV)),              // ~
+  SYM(SYM_LT,       S(KC_COMM)),             // <
+  SYM(SYM_GT,       S(KC_DOT)),              // >
+  SYM(SYM_LBRC,     KC_LBRC),                // [
+  SYM(SYM_RBRC,     KC_RBRC),                // ]
+  SYM(SYM_LCBR,     S(KC_LBRC)),             // {
+  SYM(SYM_RCBR,     S(KC_RBRC)),             // }
+  SYM(SYM_PIPE,     S(KC_BSLS)),             // |
+  SYM(SYM_BSLS,     KC_BSLS),                // (\)
+  SYM(SYM_AT,       S(KC_2)),                // @
+  SYM(SYM_SLASH,    KC_SLSH),                // /
+  SYM(SYM_INIT_A,   KC_NO),                  // ¬
+  SYM(SYM_INIT_G,   KC_NO),                  // °
+  SYM(SYM_KC_COLN,  S(KC_SCLN)),             // :
+  SYM(SYM_CARET,    S(KC_6)),                // ^  directo
+  SYM(SYM_ACUTE,    KC_NO),                  // sin muertas: vocal sola
+  SYM(SYM_DIAER,    KC_NO),
+
+  SYM(EQL_SYM,      KC_EQL),                 // =
+  SYM(MINUS_SYM,    KC_MINS),                // -
+  SYM(SLASH_SYM,    KC_SLSH),                // /
+  SYM(ASTER_SYM,    KC_KP_ASTERISK),         // *
+  SYM(PLUS_SYM,     KC_KP_PLUS),             // +
+  SYM(MINUS_UNDER,  KC_MINS, S(KC_MINS)),    // - / _
+
+  SYM(DQUO_SYM,     S(KC_QUOT)),             // "
+  SYM(SQUO_SYM,     KC_QUOT),                // '
+};
+
+/* Latinoamericano de Windows (kbdla): {[ y }] tienen tecla propia, | está en KC_GRV */
+static const symbol_t PROGMEM symbol_win_latam[SYMBOL_COUNT] = {
+  SYM(ES_NTIL,      KC_SCLN, S(KC_SCLN)),    // ñ / Ñ
+  SYM(ES_NTIL_CAP,  S(KC_SCLN)),
+  SYM(ES_IQUES,     KC_EQL),                 // ¿
+  SYM(ES_IEXCL,     S(KC_EQL)),              // ¡
+  SYM(ES_QUES,      S(KC_MINS)),             // ?
+
+  SYM(SYM_BACKTICK, RALT(KC_NUHS)),          // `  (muerta en Windows)
+  SYM(SYM_TILDE,    RALT(KC_RBRC)),          // ~
+  SYM(SYM_LT,       KC_NUBS),                // <
+  SYM(SYM_GT,       S(KC_NUBS)),             // >
+  SYM(SYM_LBRC,     S(KC_QUOT)),             // [
+  SYM(SYM_RBRC,     S(KC_NUHS)),             // ]
+  SYM(SYM_LCBR,     KC_QUOT),                // {
+  SYM(SYM_RCBR,     KC_NUHS),                // }
+  SYM(SYM_PIPE,     KC_GRV),                 // |
+  SYM(SYM_BSLS,     RALT(KC_MINS)),          // (\)
+  SYM(SYM_AT,       RALT(KC_Q)),             // @
+  SYM(SYM_SLASH,    S(KC_7)),                // /
+  SYM(SYM_INIT_A,   RALT(KC_GRV)),           // ¬
+  SYM(SYM_INIT_G,   S(KC_GRV)),              // °
+  SYM(SYM_KC_COLN,  S(KC_DOT)),              // :
+  SYM(SYM_CARET,    RALT(KC_QUOT), KC_SPC),  // ^  muerta + espacio
+  SYM(SYM_ACUTE,    KC_LBRC),                // ´  muerta, a la derecha de la P
+  SYM(SYM_DIAER,    S(KC_LBRC)),             // ¨  muerta
+
+  SYM(EQL_SYM,      S(KC_0)),                // =
+  SYM(MINUS_SYM,    KC_SLSH),                // -
+  SYM(SLASH_SYM,    S(KC_7)),                // /
+  SYM(ASTER_SYM,    KC_KP_ASTERISK),         // *
+  SYM(PLUS_SYM,     KC_KP_PLUS),             // +
+  SYM(MINUS_UNDER,  KC_SLSH, S(KC_SLSH)),    // - / _
+
+  SYM(DQUO_SYM,     S(KC_2)),                // "
+  SYM(SQUO_SYM,     KC_MINS),                // '
+};
+/* Latinoamericano de Apple, teclado ISO: { [ y } ] como en kbdla, Option (RALT) en
+   vez de AltGr para @ | \. En ISO macOS intercambia KC_GRV y KC_NUBS: < > salen de
+   KC_GRV y | ° de KC_NUBS (la tecla a la izquierda del 1) */
+static const symbol_t PROGMEM symbol_mac_latam[SYMBOL_COUNT] = {
+  SYM(ES_NTIL,      KC_SCLN, S(KC_SCLN)),    // ñ / Ñ
+  SYM(ES_NTIL_CAP,  S(KC_SCLN)),
+  SYM(ES_IQUES,     KC_EQL),                 // ¿
+  SYM(ES_IEXCL,     S(KC_EQL)),              // ¡
+  SYM(ES_QUES,      S(KC_MINS)),             // ?
+
+  SYM(SYM_BACKTICK, RALT(KC_NUHS)),          // `  Option+} (muerta)
+  SYM(SYM_TILDE,    RALT(KC_RBRC)),          // ~  Option++ (muerta)
+  SYM(SYM_LT,       KC_GRV),                 // <
+  SYM(SYM_GT,       S(KC_GRV)),              // >
+  SYM(SYM_LBRC,     S(KC_QUOT)),             // [
+  SYM(SYM_RBRC,     S(KC_NUHS)),             // ]
+  SYM(SYM_LCBR,     KC_QUOT),                // {
+  SYM(SYM_RCBR,     KC_NUHS),                // }
+  SYM(SYM_PIPE,     KC_NUBS),                // |
+  SYM(SYM_BSLS,     RALT(KC_MINS)),          // (\)  Option+'
+  SYM(SYM_AT,       RALT(KC_2)),             // @  Option+2
+  SYM(SYM_SLASH,    S(KC_7)),                // /
+  SYM(SYM_INIT_A,   RALT(KC_6)),             // ¬  Option+6
+  SYM(SYM_INIT_G,   S(KC_NUBS)),             // °
+  SYM(SYM_KC_COLN,  S(KC_DOT)),              // :
+  SYM(SYM_CARET,    RALT(KC_QUOT), KC_SPC),  // ^  Option+{ (muerta) + espacio
+  SYM(SYM_ACUTE,    KC_LBRC),                // ´  muerta, a la derecha de la P
+  SYM(SYM_DIAER,    S(KC_LBRC)),             // ¨  muerta
+
+  SYM(EQL_SYM,      S(KC_0)),                // =
+  SYM(MINUS_SYM,    KC_SLSH),                // -
+  SYM(SLASH_SYM,    S(KC_7)),                // /
+  SYM(ASTER_SYM,    KC_KP_ASTERISK),         // *
+  SYM(PLUS_SYM,     KC_KP_PLUS),             // +
+  SYM(MINUS_UNDER,  KC_SLSH, S(KC_SLSH)),    // - / _
+
+  SYM(DQUO_SYM,     S(KC_2)),                // "
+  SYM(SQUO_SYM,     KC_MINS),                // '
+};
+#undef SYM
+
+/* EEPROM (bloque de usuario): [magic][count][symbol_t x count] */
+#define SYMBOL_EE_MAGIC 0x5B
+#define SYMBOL_EE_HEADER 2
+_Static_assert(SYMBOL_EE_HEADER + sizeof(symbol_latam) <= MACRO_DELAY_EE_ADDR,
+               "EECONFIG_USER_DATA_SIZE (config.h) no alcanza para la tabla de símbolos");
+
+static symbol_t symbols[SYMBOL_COUNT];
+
+/* Tabla activa: la de RAM (LATAM) o una de PROGMEM */
+static const symbol_t *table = symbols;
+static bool table_in_flash = false;
+static uint8_t profile = SYMBOL_PROFILE_LATAM;
+
+static void load_defaults(void) {
+  memcpy_P(symbols, symbol_latam, sizeof symbols);
+}
+
+static void save_all(void) {
+  const uint8_t header[SYMBOL_EE_HEADER] = { SYMBOL_EE_MAGIC, SYMBOL_COUNT };
+  eeconfig_update_user_datablock(symbols, SYMBOL_EE_HEADER, sizeof symbols);
+  eeconfig_update_user_datablock(header, 0, sizeof header);
+}
+
+void symbol_table_init(void) {
+  uint8_t header[SYMBOL_EE_HEADER];
+  eeconfig_read_user_datablock(header, 0, sizeof header);
+  if (header[0] == SYMBOL_EE_MAGIC && header[1] == SYMBOL_COUNT) {
+    eeconfig_read_user_datablock(symbols, SYMBOL_EE_HEADER, sizeof symbols);
+  } else {
+    /* EEPROM vacía o de otro firmware: no se escribe hasta el primer cambio */
+    load_defaults();
+  }
+}
+
+static symbol_t symbol_at(uint8_t index) {
+  symbol_t s;
+  if (table_in_flash) memcpy_P(&s, &table[index], sizeof s);
+  else s = table[index];
+  return s;
+}
+
+uint16_t symbol_tap(uint16_t keycode, bool shifted) {
+  symbol_t s = symbol_at(keycode - SYMBOL_FIRST);
+  return shifted && s.shifted != KC_NO ? s.shifted : s.tap;
+}
+
+bool symbol_set_profile(uint8_t new_profile) {
+  switch (new_profile) {
+    case SYMBOL_PROFILE_LATAM:     table = symbols;          table_in_flash = false; break;
+    case SYMBOL_PROFILE_US:        table = symbol_us;        table_in_flash = true;  break;
+    case SYMBOL_PROFILE_WIN_LATAM: table = symbol_win_latam; table_in_flash = true;  break;
+    case SYMBOL_PROFILE_MAC_LATAM: table = symbol_mac_latam; table_in_flash = true;  break;
+    default: return false;
+  }
+  profile = new_profile;
+  return true;
+}
+
+uint8_t symbol_profile(void) { return profile; }
+
+#ifdef OS_DETECTION_ENABLE
+/* os_detection de QMK: se llama al asentarse la detección después de enumerar
+   (y otra vez si el host reenumera), nunca por tecla. */
+static const uint8_t PROGMEM os_profiles[] = {
+  [OS_UNSURE]  = SYMBOL_PROFILE_LATAM,
+  [OS_LINUX]   = SYMBOL_PROFILE_LATAM,
+  [OS_WINDOWS] = SYMBOL_PROFILE_WIN_LATAM,
+  [OS_MACOS]   = SYMBOL_PROFILE_MAC_LATAM,
+  [OS_IOS]     = SYMBOL_PROFILE_MAC_LATAM,
+};
+
+bool process_detected_host_os_user(os_variant_t os) {
+  if (os < sizeof os_profiles) symbol_set_profile(pgm_read_byte(&os_profiles[os]));
+  return true;
+}
+#endif
+
+/* ---------- Raw HID (symbol_table.py) ---------- */
+#define SYMBOLS_PER_REPORT ((RAW_HID_DATA - 2) / sizeof(symbol_t))
+
+uint8_t symbol_table_raw_hid(uint8_t *data, uint8_t length) {
+  uint8_t index = data[1], n = data[2];
+  uint8_t *out = data + 2;
+  switch (data[0]) {
+    case RAW_CMD_SYM_INFO:
+      out[0] = SYMBOL_COUNT;
+      out[1] = SYMBOL_FIRST & 0xFF;
+      out[2] = SYMBOL_FIRST >> 8;
+      return RAW_OK;
+    case RAW_CMD_SYM_GET:   // del perfil activo
+      if (index >= SYMBOL_COUNT) return RAW_ERR_ARG;
+      if (n > SYMBOL_COUNT - index) n = SYMBOL_COUNT - index;
+      if (n > SYMBOLS_PER_REPORT) n = SYMBOLS_PER_REPORT;
+      out[0] = index;
+      out[1] = n;
+      for (uint8_t i = 0; i < n; i++) {
+        symbol_t s = symbol_at(index + i);
+        memcpy(out + 2 + i * sizeof s, &s, sizeof s);
+      }
+      return RAW_OK;
+    case RAW_CMD_SYM_SET: {   // siempre sobre LATAM, el único editable
+      if (index >= SYMBOL_COUNT) return RAW_ERR_ARG;
+      symbol_t s = { data[2] | data[3] << 8, data[4] | data[5] << 8 };
+      uint8_t header[SYMBOL_EE_HEADER];
+      eeconfig_read_user_datablock(header, 0, sizeof header);
+      symbols[index] = s;
+      if (header[0] == SYMBOL_EE_MAGIC && header[1] == SYMBOL_COUNT) {
+        eeconfig_update_user_datablock(&s, SYMBOL_EE_HEADER + index * sizeof s, sizeof s);
+      } else {
+        save_all();   // primer cambio: se escribe la tabla entera
+      }
+      out[0] = index;
+      return RAW_OK;
+    }
+    case RAW_CMD_SYM_RESET:
+      load_defaults();
+      save_all();
+      return RAW_OK;
+    case RAW_CMD_SYM_PROFILE:   // 0xFF: solo consulta
+      if (index != 0xFF && !symbol_set_profile(index)) return RAW_ERR_ARG;
+      out[0] = profile;
+      out[1] = SYMBOL_PROFILES;
+      return RAW_OK;
+  }
+  return RAW_ERR_UNKNOWN;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include "bodegafresh_keycodes.h"
+
+/* ──────────────────────────────────────────────────────────────
+ *  Tabla de símbolos editable sin reflashear (symbol_table.c)
+ *  Cada keycode de ES_NTIL a SQUO_SYM envía tap (o shifted si hay
+ *  Shift y shifted != KC_NO). Los defaults viven en PROGMEM; los
+ *  cambios hechos por Raw HID (symbol_table.py) quedan en EEPROM.
+ *
+ *  Perfiles: uno por layout del host. LATAM es la tabla editable
+ *  (RAM + EEPROM); los demás son fijos en PROGMEM. Cambiar de
+ *  perfil (layout_daemon.py) solo cambia el puntero a la tabla.
+ *  Sin daemon, os_detection elige el perfil al enumerar.
+ * ────────────────────────────────────────────────────────────*/
+#define SYMBOL_FIRST ES_NTIL
+#define SYMBOL_LAST  SQUO_SYM
+#define SYMBOL_COUNT (SYMBOL_LAST - SYMBOL_FIRST + 1)
+
+typedef struct {
+  uint16_t tap;
+  uint16_t shifted;   // KC_NO: igual que tap
+} symbol_t;
+
+enum symbol_profile {
+  SYMBOL_PROFILE_LATAM = 0,   // editable por Raw HID
+  SYMBOL_PROFILE_US,
+  SYMBOL_PROFILE_WIN_LATAM,   // elegido por os_detection en Windows
+  SYMBOL_PROFILE_MAC_LATAM,   // elegido por os_detection en macOS / iOS
+  SYMBOL_PROFILES
+};
+
+void symbol_table_init(void);   // keyboard_post_init_user: EEPROM -> RAM
+uint16_t symbol_tap(uint16_t keycode, bool shifted);
+bool symbol_set_profile(uint8_t profile);
+uint8_t symbol_profile(void);
+uint8_t symbol_table_raw_hid(uint8_t *data, uint8_t length);
@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+layout_daemon.py
+Sigue el layout XKB activo del host y le dice al teclado por Raw HID qué perfil de
+símbolos usar (keymaps/symbol_table.c): con "us" activo, SYM_AT manda S(KC_2) en vez de
+RALT(KC_Q). En el firmware el cambio es solo un puntero; no hay que reflashear nada.
+
+Cómo se lee el layout activo (el primero que funcione):
+  1. xkb-switch -p                                   (X11, paquete xkb-switch)
+  2. gsettings ... input-sources mru-sources         (GNOME, también en Wayland)
+  3. setxkbmap -query + grupo del "LED mask" de xset -q (X11, aproximado)
+
+El teclado arranca en LATAM: si se reconecta, se le vuelve a mandar el perfil.
+
+Requisitos: hidapi (pip install hidapi) y alguno de los comandos de arriba.
+Uso:
+  python3 layout_daemon.py                       # queda corriendo
+  python3 layout_daemon.py --once                # aplica el layout actual y sale
+  python3 layout_daemon.py --map dvorak=us --interval 0.5
+"""
+
+import re, sys, time, shlex, argparse, subprocess
+
+from raw_hid import RawHid, RawHidError, CMD_SYM_PROFILE, LILY58_VID, LILY58_PID, parse_int
+from symbol_table import profile_names
+
+# prefijo del layout XKB -> perfil (enum symbol_profile). "es" (España) no está: ¿ ¡ ç
+# y los corchetes van en otras teclas que en LATAM, y no hay perfil para ese layout
+DEFAULT_MAP = {"latam": "latam", "us": "us"}
+
+def run(cmd):
+    try:
+        out = subprocess.check_output(shlex.split(cmd), stderr=subprocess.DEVNULL, timeout=2)
+        return out.decode("utf-8", errors="replace").strip()
+    except Exception:
+        return ""
+
+def layout_xkb_switch():
+    return run("xkb-switch -p") or None
+
+def layout_gnome():
+    out = run("gsettings get org.gnome.desktop.input-sources mru-sources")
+    m = re.search(r"\('xkb',\s*'([^']+)'\)", out)
+    return m.group(1) if m else None
+
+def layout_setxkbmap():
+    q = run("setxkbmap -query")
+    m = re.search(r"^layout:\s*(\S+)", q, flags=re.M)
+    if not m:
+        return None
+    layouts = m.group(1).split(",")
+    led = re.search(r"LED mask:\s*([0-9a-fA-F]+)", run("xset -q"))
+    group = 1 if led and int(led.group(1), 16) & 0x1000 else 0
+    return layouts[min(group, len(layouts) - 1)]
+
+def active_layout():
+    for probe in (layout_xkb_switch, layout_gnome, layout_setxkbmap):
+        layout = probe()
+        if layout:
+            return layout.split("(")[0]          # "us(intl)" -> "us"
+    return None
+
+def profile_for(layout, mapping):
+    for prefix, profile in sorted(mapping.items(), key=lambda kv: -len(kv[0])):
+        if layout.startswith(prefix):
+            return profile
+    return None
+
+def main():
+    ap = argparse.ArgumentParser(description="Perfil de símbolos del teclado según el layout XKB activo")
+    ap.add_argument("--vid", type=parse_int, default=LILY58_VID)
+    ap.add_argument("--pid", type=parse_int, default=LILY58_PID)
+    ap.add_argument("--map", action="append", default=[], help="LAYOUT=PERFIL (repetible)")
+    ap.add_argument("--interval", type=float, default=0.3, help="segundos entre lecturas del layout")
+    ap.add_argument("--once", action="store_true")
+    args = ap.parse_args()
+
+    profiles = profile_names()
+    mapping = dict(DEFAULT_MAP)
+    for spec in args.map:
+        layout, _, profile = spec.partition("=")
+        if profile not in profiles:
+            ap.error(f"--map {spec}: perfiles válidos: {', '.join(profiles)}")
+        mapping[layout] = profile
+
+    kb, sent, warned = None, None, set()
+    while True:
+        layout = active_layout()
+        profile = profile_for(layout, mapping) if layout else None
+        if layout and not profile and layout not in warned:
+            print(f"⚠️  layout '{layout}' sin perfil (usa --map {layout}=...)", file=sys.stderr)
+            warned.add(layout)
+        if profile and profile != sent:
+            try:
+                if kb is None:
+                    kb = RawHid(args.vid, args.pid)
+                kb.call(CMD_SYM_PROFILE, profiles.index(profile))
+                print(f"✅ {layout} -> perfil {profile}")
+                sent = profile
+            except (RawHidError, OSError) as e:
+                if args.once:
+                    sys.exit(f"❌ {e}")
+                if kb is not None:
+                    kb.close()
+                kb, sent = None, None            # se reintenta en la próxima vuelta
+        elif kb is not None and not args.once:
+            try:
+                # sigue conectado y con el perfil bueno (si se reinició, volvió a LATAM)
+                if profiles[kb.call(CMD_SYM_PROFILE, 0xFF)[0]] != sent:
+                    sent = None
+            except (RawHidError, OSError):
+                kb.close()
+                kb, sent = None, None
+        if args.once:
+            if not layout:
+                sys.exit("❌ no pude leer el layout activo (xkb-switch, gsettings o setxkbmap)")
+            return
+        time.sleep(args.interval)
+
+if __name__ == "__main__":
+    main()
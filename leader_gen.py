@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+leader_gen.py
+Genera keymaps/leader_trie_data.h para el leader del keymap (keymaps/leader_trie.c) desde
+assets/leader.txt. Las secuencias se compilan a un trie de doble arreglo (base/check):
+  - el hijo de s por la tecla k está en t = base[s] + (k - KC_A + 1), y es válido si
+    check[t] == s; cada tecla cuesta una lectura de base[] y una de check[], sin
+    recorrer la lista de secuencias ni los hermanos del nodo
+  - las hojas guardan en base[] LEADER_LEAF + índice en leader_action[]
+
+El generador busca para cada nodo la base más baja libre, así que el arreglo queda
+apenas más grande que la cantidad de nodos. Con hasta 127 posiciones los índices son
+uint8_t; si no, uint16_t.
+
+Uso:
+  python3 leader_gen.py                    # -> keymaps/leader_trie_data.h
+  python3 leader_gen.py --check            # falla si el .h está desactualizado
+  python3 leader_gen.py --show             # secuencias y trie
+"""
+
+import re, sys, argparse
+from pathlib import Path
+
+from keymap_sparse_gen import strip_comments
+from qmk_keycodes import parse, name, BASIC
+
+HERE = Path(__file__).resolve().parent
+SRC = HERE / "assets" / "leader.txt"
+KEYCODES_H = HERE / "keymaps" / "bodegafresh_keycodes.h"
+OUT = HERE / "keymaps" / "leader_trie_data.h"
+
+KC_A, KC_LAST = BASIC["KC_A"], BASIC["KC_SLSH"]   # alfabeto: 1..53
+
+def custom_keycodes():
+    src = strip_comments(KEYCODES_H.read_text(encoding="utf-8"))
+    body = re.search(r"enum\s+custom_keycodes\s*\{([^}]*)\}", src).group(1)
+    return {m.group(1) for m in re.finditer(r"(\w+)\s*(?:=[^,]*)?,", body + ",")}
+
+def key_code(token):
+    """'g' -> KC_G, '1' -> KC_1, 'KC_DOT' -> KC_DOT."""
+    kc = parse("KC_" + token.upper()) if re.fullmatch(r"[a-zA-Z0-9]", token) else parse(token)
+    if not KC_A <= kc <= KC_LAST:
+        raise ValueError(f"{token}: solo teclas básicas de KC_A a KC_SLSH")
+    return kc
+
+def parse_leader(text, custom):
+    """[([keycodes], acción)]"""
+    out = []
+    for n, line in enumerate(text.splitlines(), 1):
+        line = line.strip()
+        if not line or line.startswith("#"):
+            continue
+        keys, sep, action = line.partition("->")
+        action = action.strip()
+        if not sep or not keys.split() or not action:
+            sys.exit(f"❌ leader.txt:{n}: se espera 'TECLAS -> ACCIÓN'")
+        try:
+            seq = [key_code(t) for t in keys.split()]
+            if action not in custom:
+                parse(action)
+        except ValueError as e:
+            sys.exit(f"❌ leader.txt:{n}: {e}")
+        out.append((seq, action))
+    return out
+
+def build_trie(seqs):
+    """Trie como dict anidado; valida duplicados y prefijos."""
+    root = {}
+    for seq, action in seqs:
+        node = root
+        for i, kc in enumerate(seq):
+            if "action" in node:
+                sys.exit(f"❌ {keys_label(seq[:i])} ya dispara {node['action']}: no puede ser prefijo")
+            node = node.setdefault(kc, {})
+        if node.keys() - {"action", "keys"}:
+            sys.exit(f"❌ {keys_label(seq)} es prefijo de otra secuencia")
+        if "action" in node:
+            sys.exit(f"❌ {keys_label(seq)} repetida")
+        node["action"], node["keys"] = action, seq
+    return root
+
+def keys_label(seq):
+    return " ".join(name(k)[3:].lower() for k in seq)
+
+def double_array(root):
+    """-> (base, check, acciones); la raíz es la posición 0."""
+    base, check, actions = [0], [None], []
+    queue = [(0, root)]
+    while queue:
+        slot, node = queue.pop(0)
+        if "action" in node:
+            base[slot] = ("leaf", len(actions))
+            actions.append((node["action"], node["keys"]))
+            continue
+        labels = sorted(k - KC_A + 1 for k in node)
+        b = 0
+        while any(b + c < len(check) and (check[b + c] is not None or b + c == 0) for c in labels):
+            b += 1
+        need = b + max(labels) + 1
+        base += [0] * (need - len(base))
+        check += [None] * (need - len(check))
+        base[slot] = b
+        for c in labels:
+            check[b + c] = slot
+            queue.append((b + c, node[c + KC_A - 1]))
+    return base, check, actions
+
+def render(base, check, actions):
+    size = len(base)
+    wide = size > 127 or len(actions) > 127
+    ctype, leaf, empty = ("uint16_t", 0x8000, 0xFFFF) if wide else ("uint8_t", 0x80, 0xFF)
+    fmt = "%5d" if wide else "%3d"
+    def base_val(v):
+        return leaf + v[1] if isinstance(v, tuple) else v
+    o = ["/* Generado por leader_gen.py desde assets/leader.txt. NO editar a mano. */",
+         "#pragma once",
+         "#include <avr/pgmspace.h>",
+         "",
+         "typedef %s leader_index_t;" % ctype,
+         "#define LEADER_SIZE  %d" % size,
+         "#define LEADER_LEAF  0x%X   // base[] de una hoja: LEADER_LEAF + acción" % leaf,
+         "#define LEADER_EMPTY 0x%X   // check[] de una posición libre" % empty,
+         "",
+         "static const leader_index_t PROGMEM leader_base[LEADER_SIZE] = {"]
+    for i in range(0, size, 16):
+        o.append("  " + ", ".join(fmt % base_val(v) for v in base[i:i + 16]) + ",")
+    o += ["};", "",
+          "static const leader_index_t PROGMEM leader_check[LEADER_SIZE] = {"]
+    for i in range(0, size, 16):
+        o.append("  " + ", ".join(fmt % (empty if v is None else v) for v in check[i:i + 16]) + ",")
+    o += ["};", "",
+          "static const uint16_t PROGMEM leader_action[%d] = {" % len(actions)]
+    for action, seq in actions:
+        o.append("  %s,  // %s" % (action, keys_label(seq)))
+    o.append("};")
+    return "\n".join(o) + "\n"
+
+def main():
+    ap = argparse.ArgumentParser(description="Trie de doble arreglo para las secuencias de leader")
+    ap.add_argument("--src", default=str(SRC))
+    ap.add_argument("--out", default=str(OUT))
+    ap.add_argument("--check", action="store_true", help="solo verifica que el .h esté al día")
+    ap.add_argument("--show", action="store_true", help="imprime las secuencias y el trie")
+    args = ap.parse_args()
+
+    seqs = parse_leader(Path(args.src).read_text(encoding="utf-8"), custom_keycodes())
+    if not seqs:
+        sys.exit("❌ leader.txt sin secuencias")
+    base, check, actions = double_array(build_trie(seqs))
+
+    if args.show:
+        for seq, action in seqs:
+            print(f"{keys_label(seq):<12} -> {action}")
+        used = sum(c is not None for c in check) + 1
+        print(f"\n{len(base)} posiciones, {used} nodos, {len(actions)} acciones")
+        return
+
+    text = render(base, check, actions)
+    out = Path(args.out)
+    if args.check:
+        if not out.exists() or out.read_text(encoding="utf-8") != text:
+            print(f"❌ {out.name} desactualizado: python3 leader_gen.py"); sys.exit(1)
+        print(f"✅ {out.name} al día.")
+        return
+    out.write_text(text, encoding="utf-8")
+    width = 2 if len(base) > 127 or len(actions) > 127 else 1
+    print(f"{out.name}: {len(seqs)} secuencias, {2 * width * len(base) + 2 * len(actions)} bytes de flash",
+          file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
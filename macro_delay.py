@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+macro_delay.py
+Calibra la espera entre toques de las macros del firmware (keymaps/macro_delay.c) contra
+el host real. tap_once16() (```) y la completa de las teclas muertas (^) esperan
+macro_delay() ms; con poca espera algunos hosts pierden toques repetidos o componen mal
+la tecla muerta, con mucha la macro se siente lenta.
+
+Cómo calibra: pone la terminal en modo crudo, le pide al teclado por Raw HID que corra
+cada macro de prueba (RAW_CMD_MACRO_RUN) y lee lo que llega a la terminal. Eso es el
+texto ya pasado por XKB y por la composición de teclas muertas, que es lo que importa
+(evdev solo vería las teclas). Busca en binario la espera mínima con la que todas las
+pruebas salen bien --tries veces, le suma --margin y la guarda en EEPROM.
+
+La terminal tiene que tener el foco mientras calibra: el teclado escribe ahí.
+
+Requisitos: hidapi (pip install hidapi) y una terminal (no sirve con stdin redirigido).
+Uso:
+  python3 macro_delay.py                       # espera activa y default del firmware
+  python3 macro_delay.py set 12                # solo RAM (se pierde al reiniciar)
+  python3 macro_delay.py set 12 --save         # RAM + EEPROM
+  python3 macro_delay.py calibrate             # búsqueda binaria y guarda
+  python3 macro_delay.py calibrate --tries 10 --margin 4 --dry-run
+  python3 macro_delay.py calibrate --test 'BKTICK3_SYM=```' --test 'SYM_CARET=^'
+"""
+
+import os, re, sys, select, argparse
+
+from keymap_sparse_gen import strip_comments
+from raw_hid import (RawHid, RawHidError, CMD_SYM_INFO, CMD_MACRO_DELAY, CMD_MACRO_SAVE,
+                     CMD_MACRO_RUN, LILY58_VID, LILY58_PID, parse_int)
+from oled_emulator import KEYMAP_DIR
+
+# macros que usan macro_delay() y lo que tiene que aparecer en la terminal
+DEFAULT_TESTS = [("BKTICK3_SYM", "```"), ("SYM_CARET", "^")]
+
+def macro_delay_max():
+    header = (KEYMAP_DIR / "macro_delay.h").read_text(encoding="utf-8")
+    return int(re.search(r"#define\s+MACRO_DELAY_MAX\s+(\d+)", header).group(1))
+
+def custom_names():
+    """Nombres de enum custom_keycodes en orden (el primero vale SAFE_RANGE)."""
+    src = strip_comments((KEYMAP_DIR / "bodegafresh_keycodes.h").read_text(encoding="utf-8"))
+    body = re.search(r"enum\s+custom_keycodes\s*\{([^}]*)\}", src).group(1)
+    return [re.match(r"\s*(\w+)", item).group(1) for item in body.split(",") if item.strip()]
+
+def test_keycodes(kb, tests):
+    """[(nombre, keycode, texto)]; SAFE_RANGE sale del firmware (RAW_CMD_SYM_INFO)."""
+    info = kb.call(CMD_SYM_INFO)
+    base = info[1] | info[2] << 8
+    names = custom_names()
+    out = []
+    for name, text in tests:
+        if name not in names:
+            sys.exit(f"❌ {name}: no está en enum custom_keycodes")
+        out.append((name, base + names.index(name), text))
+    return out
+
+class RawTerminal:
+    """stdin en modo crudo y sin eco, para leer lo que escribe el teclado."""
+    def __enter__(self):
+        import termios, tty
+        if not sys.stdin.isatty():
+            sys.exit("❌ calibrate necesita una terminal (stdin no es una tty)")
+        self.termios, self.fd = termios, sys.stdin.fileno()
+        self.saved = termios.tcgetattr(self.fd)
+        tty.setraw(self.fd)
+        return self
+
+    def __exit__(self, *exc):
+        self.termios.tcsetattr(self.fd, self.termios.TCSADRAIN, self.saved)
+
+    def flush(self):
+        self.termios.tcflush(self.fd, self.termios.TCIFLUSH)
+
+    def read(self, want, timeout):
+        """Hasta want caracteres o timeout segundos sin que llegue nada nuevo."""
+        out = b""
+        while len(out.decode("utf-8", errors="ignore")) < want:
+            ready, _, _ = select.select([self.fd], [], [], timeout)
+            if not ready:
+                break
+            out += os.read(self.fd, 64)
+        return out.decode("utf-8", errors="replace")
+
+def run_test(kb, term, keycode, text, settle):
+    term.flush()
+    kb.call(CMD_MACRO_RUN, keycode & 0xFF, keycode >> 8)
+    got = term.read(len(text), settle)
+    if got == text:
+        got += term.read(1, settle / 4)    # de más: p. ej. el espacio de una muerta que no compuso
+    return got
+
+def passes(kb, term, tests, delay, tries, settle, log):
+    kb.call(CMD_MACRO_DELAY, delay)
+    for name, keycode, text in tests:
+        for _ in range(tries):
+            got = run_test(kb, term, keycode, text, settle)
+            if got != text:
+                log(f"  {delay:3d} ms  ❌ {name}: {got!r} en vez de {text!r}")
+                return False
+    log(f"  {delay:3d} ms  ✅")
+    return True
+
+def calibrate(kb, args):
+    tests = test_keycodes(kb, [t.partition("=")[::2] for t in args.test] if args.test else DEFAULT_TESTS)
+    original = kb.call(CMD_MACRO_DELAY, 0xFF)[0]
+    log = lambda s: print(s, end="\r\n", flush=True)   # \r: la terminal está en crudo
+    print(f"Calibrando entre {args.min} y {args.max} ms; no toques el teclado.\r\n", flush=True)
+    best = None
+    try:
+        with RawTerminal() as term:
+            if not passes(kb, term, tests, args.max, args.tries, args.settle, log):
+                kb.call(CMD_MACRO_DELAY, original)
+                sys.exit(f"❌ ni con {args.max} ms salen bien las pruebas (¿la terminal tiene el foco? "
+                         "¿layout LATAM?)")
+            lo, hi = args.min, args.max          # hi siempre pasa
+            while lo < hi:
+                mid = (lo + hi) // 2
+                if passes(kb, term, tests, mid, args.tries, args.settle, log):
+                    hi = mid
+                else:
+                    lo = mid + 1
+            best = hi
+    except KeyboardInterrupt:
+        kb.call(CMD_MACRO_DELAY, original)
+        sys.exit("⚠️  Cancelado: queda la espera de antes.")
+    delay = min(best + args.margin, args.max)
+    kb.call(CMD_MACRO_DELAY, delay)
+    if args.dry_run:
+        print(f"✅ mínimo {best} ms; con margen {delay} ms (solo RAM, --dry-run)")
+        return
+    kb.call(CMD_MACRO_SAVE)
+    print(f"✅ mínimo {best} ms; guardado {delay} ms en EEPROM (antes {original} ms)")
+
+def main():
+    ap = argparse.ArgumentParser(description="Espera entre toques de las macros, calibrada contra el host")
+    ap.add_argument("--vid", type=parse_int, default=LILY58_VID)
+    ap.add_argument("--pid", type=parse_int, default=LILY58_PID)
+    sub = ap.add_subparsers(dest="cmd")
+    s = sub.add_parser("set", help="fija la espera en ms")
+    s.add_argument("ms", type=int)
+    s.add_argument("--save", action="store_true", help="también en EEPROM")
+    c = sub.add_parser("calibrate", help="búsqueda binaria con las macros de prueba")
+    c.add_argument("--min", type=int, default=0)
+    c.add_argument("--max", type=int, default=40)
+    c.add_argument("--tries", type=int, default=5, help="repeticiones de cada prueba por espera")
+    c.add_argument("--margin", type=int, default=2, help="ms que se suman al mínimo encontrado")
+    c.add_argument("--settle", type=float, default=0.5, help="segundos sin texto nuevo para dar una prueba por terminada")
+    c.add_argument("--test", action="append", default=[], help="KEYCODE=texto esperado (repetible)")
+    c.add_argument("--dry-run", action="store_true", help="no guarda en EEPROM")
+    args = ap.parse_args()
+
+    limit = macro_delay_max()
+    if args.cmd == "set" and not 0 <= args.ms <= limit:
+        ap.error(f"ms entre 0 y {limit}")
+    if args.cmd == "calibrate" and not 0 <= args.min <= args.max <= limit:
+        ap.error(f"se espera 0 <= --min <= --max <= {limit}")
+
+    try:
+        with RawHid(args.vid, args.pid) as kb:
+            if args.cmd == "set":
+                kb.call(CMD_MACRO_DELAY, args.ms)
+                if args.save:
+                    kb.call(CMD_MACRO_SAVE)
+                print(f"✅ {args.ms} ms{' (EEPROM)' if args.save else ' (solo RAM)'}")
+            elif args.cmd == "calibrate":
+                calibrate(kb, args)
+            else:
+                current, default = kb.call(CMD_MACRO_DELAY, 0xFF)[:2]
+                print(f"espera entre toques: {current} ms (default del firmware {default} ms)")
+    except RawHidError as e:
+        sys.exit(f"❌ {e}")
+
+if __name__ == "__main__":
+    main()
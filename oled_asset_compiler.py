@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+oled_asset_compiler.py
+Compila imágenes PNG/SVG a bitmaps del SSD1306 (páginas de 8 px, 1 byte por columna)
+y las parte en tiles de 8x8. Los tiles idénticos entre todos los assets se guardan una
+sola vez: cada asset queda como un mapa de índices a la tabla común de tiles.
+
+Salida: un header con
+  - <prefix>_tiles[][8]        tiles únicos (PROGMEM)
+  - <prefix>_<asset>_map[]     índices de tile (un byte: hasta 256 tiles únicos por
+                               header), una fila de tiles por página
+  - <PREFIX>_<ASSET>_W_TILES / _H_PAGES   tamaño del asset en tiles
+El firmware los dibuja con oled_tiles_draw() (keymaps/oled_tiles.c).
+
+SVG: se rasteriza con rsvg-convert o inkscape si están instalados.
+TXT: arte ASCII ('#' encendido), cómodo para íconos chicos versionados en git.
+Uso:
+  python3 oled_asset_compiler.py assets/layer_icons/{base,sym,num,sys,nav,acc}.txt \
+      --prefix layer_icons > keymaps/layer_icons.h
+  python3 oled_asset_compiler.py base.png sym.svg --dither     # Floyd–Steinberg
+  python3 oled_asset_compiler.py base.png --invert --preview   # vista ASCII por stderr
+"""
+
+import re, sys, shutil, argparse, tempfile, subprocess
+from pathlib import Path
+
+from oled_logo_rle import load_png
+
+TILE = 8
+MAX_TILES = 0x100   # oled_tiles_draw() lee cada índice con pgm_read_byte()
+
+# ---------- Carga ----------
+def rasterize_svg(path, height=None):
+    tmp = Path(tempfile.mkdtemp()) / (Path(path).stem + ".png")
+    if shutil.which("rsvg-convert"):
+        cmd = ["rsvg-convert", str(path), "-o", str(tmp)] + (["-h", str(height)] if height else [])
+    elif shutil.which("inkscape"):
+        cmd = ["inkscape", str(path), "--export-type=png", f"--export-filename={tmp}"] + \
+              ([f"--export-height={height}"] if height else [])
+    else:
+        sys.exit("⚠️  Para SVG instala librsvg2-bin (rsvg-convert) o inkscape")
+    subprocess.check_call(cmd)
+    return tmp
+
+def load_ascii(path):
+    """Arte ASCII: '#' = píxel encendido, cualquier otro carácter = apagado."""
+    rows = Path(path).read_text(encoding="utf-8").rstrip("\n").split("\n")
+    w = max(len(r) for r in rows)
+    return w, len(rows), [[255 if x < len(r) and r[x] == "#" else 0 for x in range(w)] for r in rows]
+
+def load_image(path, height=None):
+    if Path(path).suffix.lower() == ".txt":
+        return load_ascii(path)
+    if Path(path).suffix.lower() == ".svg":
+        path = rasterize_svg(path, height)
+    return load_png(path)
+
+# ---------- Monocromo ----------
+def threshold(w, h, lum, level=128):
+    return [[lum[y][x] >= level for x in range(w)] for y in range(h)]
+
+def floyd_steinberg(w, h, lum):
+    err = [[float(v) for v in row] for row in lum]
+    out = [[False] * w for _ in range(h)]
+    for y in range(h):
+        for x in range(w):
+            old = err[y][x]
+            new = 255.0 if old >= 128 else 0.0
+            out[y][x] = new > 0
+            e = old - new
+            if x + 1 < w:               err[y][x + 1]     += e * 7 / 16
+            if y + 1 < h and x > 0:     err[y + 1][x - 1] += e * 3 / 16
+            if y + 1 < h:               err[y + 1][x]     += e * 5 / 16
+            if y + 1 < h and x + 1 < w: err[y + 1][x + 1] += e * 1 / 16
+    return out
+
+def to_tiles(w, h, bits, invert=False):
+    """Rellena a múltiplos de 8 y devuelve (w_tiles, h_pages, [tile de 8 bytes])."""
+    wt, hp = (w + TILE - 1) // TILE, (h + TILE - 1) // TILE
+    tiles = []
+    for page in range(hp):
+        for tx in range(wt):
+            t = bytearray(TILE)
+            for cx in range(TILE):
+                x = tx * TILE + cx
+                for bit in range(TILE):
+                    y = page * TILE + bit
+                    on = bits[y][x] if (x < w and y < h) else False
+                    if on != invert:
+                        t[cx] |= 1 << bit
+            tiles.append(bytes(t))
+    return wt, hp, tiles
+
+def c_name(stem):
+    name = re.sub(r"\W", "_", stem).lower()
+    return "_" + name if name[0].isdigit() else name
+
+# ---------- Salida ----------
+def render_header(prefix, assets, unique):
+    raw = sum(a["wt"] * a["hp"] * TILE for a in assets)
+    packed = len(unique) * TILE + sum(a["wt"] * a["hp"] for a in assets)
+    o = ["/* Generado por oled_asset_compiler.py. NO editar a mano. */",
+         "#pragma once",
+         "#include <avr/pgmspace.h>",
+         "",
+         "/* %d assets, %d tiles únicos: %d bytes (vs %d sin deduplicar) */"
+         % (len(assets), len(unique), packed, raw),
+         "#define %s_TILE_COUNT %d" % (prefix.upper(), len(unique)),
+         "typedef uint8_t %s_index_t;" % prefix,
+         "",
+         "static const uint8_t PROGMEM %s_tiles[][8] = {" % prefix]
+    for i, t in enumerate(unique):
+        o.append("  { %s }, /* %d */" % (", ".join("0x%02X" % b for b in t), i))
+    o.append("};")
+    for a in assets:
+        up = a["name"].upper()
+        o.append("")
+        o.append("/* %s: %dx%d px (%s) */" % (a["name"], a["w"], a["h"], a["src"]))
+        o.append("#define %s_W_TILES %d" % (up, a["wt"]))
+        o.append("#define %s_H_PAGES %d" % (up, a["hp"]))
+        o.append("static const %s_index_t PROGMEM %s_map[] = {" % (prefix, a["name"]))
+        for p in range(a["hp"]):
+            row = a["map"][p * a["wt"]:(p + 1) * a["wt"]]
+            o.append("  " + ", ".join(str(i) for i in row) + ",")
+        o.append("};")
+    return "\n".join(o) + "\n"
+
+def preview(a, unique):
+    for p in range(a["hp"]):
+        for bit in range(TILE):
+            line = ""
+            for tx in range(a["wt"]):
+                t = unique[a["map"][p * a["wt"] + tx]]
+                line += "".join("#" if t[c] >> bit & 1 else "." for c in range(TILE))
+            print(line, file=sys.stderr)
+
+def main():
+    ap = argparse.ArgumentParser(description="PNG/SVG -> tiles 8x8 deduplicados para SSD1306")
+    ap.add_argument("images", nargs="+")
+    ap.add_argument("--prefix", default="oled_assets", help="prefijo de la tabla de tiles")
+    ap.add_argument("--dither", action="store_true", help="Floyd–Steinberg en vez de umbral")
+    ap.add_argument("--threshold", type=int, default=128)
+    ap.add_argument("--invert", action="store_true", help="enciende los píxeles oscuros")
+    ap.add_argument("--height", type=int, help="alto de rasterizado para SVG")
+    ap.add_argument("--preview", action="store_true", help="dibuja cada asset en ASCII por stderr")
+    args = ap.parse_args()
+
+    unique, index, assets = [], {}, []
+    for path in args.images:
+        w, h, lum = load_image(path, args.height)
+        bits = floyd_steinberg(w, h, lum) if args.dither else threshold(w, h, lum, args.threshold)
+        wt, hp, tiles = to_tiles(w, h, bits, invert=args.invert)
+        amap = []
+        for t in tiles:
+            if t not in index:
+                index[t] = len(unique); unique.append(t)
+            amap.append(index[t])
+        assets.append({"name": f"{args.prefix}_{c_name(Path(path).stem)}", "src": Path(path).name,
+                       "w": w, "h": h, "wt": wt, "hp": hp, "map": amap})
+
+    if len(unique) > MAX_TILES:
+        sys.exit(f"❌ {len(unique)} tiles únicos: el máximo es {MAX_TILES} (índices de un byte en "
+                 "oled_tiles_draw()); parte los assets en varios headers con --prefix distinto")
+    sys.stdout.write(render_header(args.prefix, assets, unique))
+    for a in assets:
+        print(f"{a['name']}: {a['wt']}x{a['hp']} tiles", file=sys.stderr)
+        if args.preview:
+            preview(a, unique)
+    print(f"{len(unique)} tiles únicos de {sum(len(a['map']) for a in assets)}", file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
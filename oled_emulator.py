@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+oled_emulator.py
+Compila keymap.c para el host con un OLED SSD1306 128x32 emulado (host/oled_mock.c),
+corre oled_task_user() capa por capa y compara cada frame contra un snapshot en
+host/snapshots/. Cada snapshot guarda también los bytes I2C de cada frame, así que un
+cambio de dibujo que redibuje de más hace fallar --check igual que un píxel distinto.
+
+Tráfico I2C modelado como el driver de QMK: solo se envían los bloques sucios
+(32 bytes + 10 de direccionamiento); escribir un byte igual al que ya está no ensucia.
+Encender, apagar y cambiar el brillo cuentan como comandos sueltos (idle_manager.c).
+
+Requisitos: cc (gcc o clang). Sin QMK: los headers mínimos están en host/qmk/.
+Uso:
+  python3 oled_emulator.py                   # compara contra host/snapshots (para CI)
+  python3 oled_emulator.py --update          # regenera los snapshots
+  python3 oled_emulator.py --png /tmp/oled   # además guarda cada frame como PNG (x4)
+  python3 oled_emulator.py --show            # dibuja los frames en ASCII
+"""
+
+import os, re, sys, zlib, struct, argparse, subprocess
+from pathlib import Path
+
+from flash_size_report import parse_rules_mk
+
+HERE = Path(__file__).resolve().parent
+HOST_DIR = HERE / "host"
+KEYMAP_DIR = HERE / "keymaps"
+SNAP_DIR = HOST_DIR / "snapshots"
+FRAMES_BIN = HOST_DIR / "oled_frames"
+HOST_SRCS = ["oled_frames.c", "oled_mock.c", "qmk_host.c"]
+OLED_W, OLED_H = 128, 32
+
+# ---------- Build ----------
+def keymap_sources():
+    """keymap.c más los SRC propios de rules.mk (los de lib/ son del teclado, no de este repo)."""
+    _flags, srcs = parse_rules_mk()
+    own = [KEYMAP_DIR / s for s in srcs if not s.startswith("./lib/")]
+    return [KEYMAP_DIR / "keymap.c"] + own
+
+def build(out, host_srcs, defines=(), libs=()):
+    """Compila los .c del host más el keymap; 'defines' son los X_ENABLE del build."""
+    cc = os.environ.get("CC", "cc")
+    cmd = [cc, "-std=gnu11", "-O1", "-Wall", "-Wextra", "-Wno-unused-parameter",
+           "-I", str(HOST_DIR / "qmk"), "-I", str(KEYMAP_DIR),
+           '-DQMK_KEYBOARD_H="lily58.h"'] + [f"-D{d}" for d in defines]
+    cmd += [str(HOST_DIR / s) for s in host_srcs] + [str(s) for s in keymap_sources()]
+    cmd += ["-o", str(out)] + list(libs)
+    try:
+        subprocess.run(cmd, check=True)
+    except FileNotFoundError:
+        sys.exit(f"⚠️  No se encontró '{cc}'.")
+    except subprocess.CalledProcessError:
+        sys.exit("⚠️  El keymap no compila en el host (ver errores arriba).")
+
+# ---------- Escenario ----------
+def layer_numbers():
+    text = (KEYMAP_DIR / "bodegafresh_keycodes.h").read_text(encoding="utf-8")
+    body = re.search(r"enum\s+layer_number\s*\{([^}]*)\}", text).group(1)
+    names, n = {}, 0
+    for item in body.split(","):
+        m = re.match(r"\s*_(\w+)\s*(?:=\s*(\d+))?", item)
+        if m:
+            n = int(m.group(2)) if m.group(2) else n
+            names[m.group(1).lower()] = n
+            n += 1
+    return names
+
+def tri_layers(layers):
+    """{capa: (capa1, capa2)} de los update_tri_layer_state() del keymap: esas capas
+    solo se prenden con las otras dos."""
+    text = (KEYMAP_DIR / "keymap.c").read_text(encoding="utf-8")
+    return {layers[c.lower()]: (layers[a.lower()], layers[b.lower()]) for a, b, c in
+            re.findall(r"update_tri_layer_state\(\s*\w+\s*,\s*_(\w+)\s*,\s*_(\w+)\s*,\s*_(\w+)\s*\)", text)}
+
+def scenario():
+    """Arranque en BASE y luego cada capa, volviendo a BASE al final: los bytes de cada
+    snapshot son los del cambio de capa, no los de dibujar desde cero."""
+    layers = layer_numbers()
+    tri = tri_layers(layers)
+    cmds = ["frame 3", "dump base"]
+    for name, n in layers.items():
+        if n:
+            cmds += ["layer " + " ".join(map(str, tri.get(n, (n,)))), "frame 2", f"dump {name}"]
+    cmds += ["layer 0", "frame 2", "dump base_back"]
+    # inactividad (idle_manager.c): atenuado, apagado y una tecla (H) que despierta
+    cmds += ["ms 31000", "frame 2", "dump idle_dim",
+             "ms 90000", "frame 2", "dump idle_blank",
+             "key 7 5 d", "frame", "key 7 5 u", "frame", "dump idle_wake"]
+    return cmds
+
+def run_frames(cmds):
+    out = subprocess.run([str(FRAMES_BIN)], input="\n".join(cmds) + "\n", capture_output=True,
+                         text=True, check=True).stdout
+    shots, pending = [], []
+    for line in out.splitlines():
+        kind, _, rest = line.partition(" ")
+        if kind == "frame":
+            pending.append(int(rest))
+        elif kind == "dump":
+            name, on, level, buf = rest.split()
+            shots.append((name, bytes.fromhex(buf), pending, (on == "1", int(level)))); pending = []
+    return shots
+
+# ---------- Render ----------
+def pixels(buf):
+    return [[buf[(y // 8) * OLED_W + x] >> (y % 8) & 1 for x in range(OLED_W)] for y in range(OLED_H)]
+
+def ascii_art(buf):
+    return "\n".join("".join("#" if p else "." for p in row) for row in pixels(buf))
+
+def write_png(path, buf, scale=4):
+    rows = b""
+    for row in pixels(buf):
+        line = b"".join(b"\xff" if p else b"\x00" for p in row for _ in range(scale))
+        rows += (b"\x00" + line) * scale
+
+    def chunk(typ, data):
+        return struct.pack(">I", len(data)) + typ + data + struct.pack(">I", zlib.crc32(typ + data))
+    ihdr = struct.pack(">IIBBBBB", OLED_W * scale, OLED_H * scale, 8, 0, 0, 0, 0)
+    Path(path).write_bytes(b"\x89PNG\r\n\x1a\n" + chunk(b"IHDR", ihdr) +
+                           chunk(b"IDAT", zlib.compress(rows, 9)) + chunk(b"IEND", b""))
+
+def snapshot_text(name, buf, frames, power):
+    on, level = power
+    return (f"# oled_emulator.py: {name}\n"
+            f"# pantalla: {'encendida' if on else 'apagada'}, brillo {level}\n"
+            f"# bytes I2C por frame: {' '.join(str(b) for b in frames)}\n" + ascii_art(buf) + "\n")
+
+def main():
+    ap = argparse.ArgumentParser(description="Emulador del OLED 128x32 con snapshots por capa")
+    ap.add_argument("--update", action="store_true", help="reescribe host/snapshots/")
+    ap.add_argument("--png", help="directorio donde guardar cada frame como PNG")
+    ap.add_argument("--show", action="store_true", help="dibuja los frames en ASCII")
+    args = ap.parse_args()
+
+    # con SCAN_METER aunque rules.mk lo deja apagado: los snapshots cubren también el medidor
+    build(FRAMES_BIN, HOST_SRCS, ["OLED_ENABLE", "SCAN_METER"])
+    shots = run_frames(scenario())
+    if args.png:
+        Path(args.png).mkdir(parents=True, exist_ok=True)
+
+    print(f"{'frame':<12} {'bytes I2C por frame':<24} {'total':>6}")
+    failed = []
+    for name, buf, frames, power in shots:
+        print(f"{name:<12} {' '.join(str(b) for b in frames):<24} {sum(frames):>6}")
+        if args.show:
+            print(ascii_art(buf))
+        if args.png:
+            write_png(Path(args.png) / f"{name}.png", buf if power[0] else bytes(len(buf)))
+        snap = SNAP_DIR / f"{name}.txt"
+        text = snapshot_text(name, buf, frames, power)
+        if args.update:
+            SNAP_DIR.mkdir(exist_ok=True)
+            snap.write_text(text, encoding="utf-8")
+        elif not snap.exists() or snap.read_text(encoding="utf-8") != text:
+            failed.append(name)
+
+    if args.update:
+        print(f"\nSnapshots actualizados en {SNAP_DIR.relative_to(HERE)}/")
+    elif failed:
+        print(f"\n❌ Difieren del snapshot: {', '.join(failed)}\n"
+              "   Revisa con --show/--png y, si el cambio es intencional, corre --update.")
+        sys.exit(1)
+    else:
+        print("\n✅ Todos los frames coinciden con host/snapshots/.")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+oled_logo_rle.py
+Convierte un PNG (o el bitmap de un header existente) en un flujo RLE para el OLED
+SSD1306 128x32 del Lily58. El firmware (keymaps/oled_rle.c) lo descomprime una sola
+vez directo al buffer del OLED, en el mismo orden que oled_write_raw_byte().
+
+Formato RLE (byte de control + datos):
+  - 2 bytes: largo descomprimido (little endian)
+  - ctrl 0x00..0x7F : siguen ctrl+1 bytes literales
+  - ctrl 0x80..0xFF : el byte siguiente se repite ctrl-0x7E veces (2..129)
+
+Sin dependencias: el PNG se lee con zlib (8 bits o paleta/gris de 1/2/4 bits).
+Uso:
+  python3 oled_logo_rle.py logo.png --name bodegafresh_logo > keymaps/bodegafresh_logo.h
+  python3 oled_logo_rle.py logo.png --invert              # píxel encendido = oscuro
+  python3 oled_logo_rle.py --from-header viejo.h --pad 256  # recomprime un arreglo ya existente
+"""
+
+import re, sys, zlib, struct, argparse
+from pathlib import Path
+
+OLED_W, OLED_H = 128, 32
+
+# ---------- PNG mínimo ----------
+def load_png(path):
+    """Devuelve (ancho, alto, [[luminancia 0..255]]) con alfa compuesto sobre negro."""
+    data = Path(path).read_bytes()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"⚠️  {path} no es un PNG")
+    pos, idat, plte, trns = 8, b"", None, None
+    while pos < len(data):
+        ln, typ = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + ln]
+        pos += 12 + ln
+        if typ == b"IHDR":
+            w, h, depth, ctype, _c, _f, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif typ == b"PLTE":
+            plte = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif typ == b"tRNS":
+            trns = chunk
+        elif typ == b"IDAT":
+            idat += chunk
+        elif typ == b"IEND":
+            break
+    if interlace:
+        sys.exit("⚠️  PNG entrelazado no soportado; re-exporta sin interlace")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    bpp = max(1, channels * depth // 8)
+    stride = (w * channels * depth + 7) // 8
+    raw = zlib.decompress(idat)
+
+    rows, prev = [], bytearray(stride)
+    for y in range(h):
+        f = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if f == 1:   line[i] = (line[i] + a) & 0xFF
+            elif f == 2: line[i] = (line[i] + b) & 0xFF
+            elif f == 3: line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif f == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        rows.append(line); prev = line
+
+    def samples(line):
+        if depth == 8:
+            return list(line)
+        if depth == 16:
+            return [line[i] for i in range(0, len(line), 2)]
+        per = 8 // depth
+        out = []
+        for byte in line:
+            for k in range(per):
+                out.append((byte >> (8 - depth * (k + 1))) & ((1 << depth) - 1))
+        return out
+
+    lum = []
+    for line in rows:
+        s = samples(line)
+        out = []
+        for x in range(w):
+            if ctype == 3:
+                r, g, b = plte[s[x]]
+                alpha = trns[s[x]] if trns and s[x] < len(trns) else 255
+            elif ctype in (0, 4):
+                v = s[x * channels] * (255 // ((1 << depth) - 1) if depth < 8 else 1)
+                r = g = b = v
+                alpha = s[x * channels + 1] if ctype == 4 else 255
+            else:
+                r, g, b = s[x * channels:x * channels + 3]
+                alpha = s[x * channels + 3] if ctype == 6 else 255
+            out.append(((r * 299 + g * 587 + b * 114) // 1000) * alpha // 255)
+        lum.append(out)
+    return w, h, lum
+
+# ---------- Bitmap -> páginas SSD1306 ----------
+def to_pages(w, h, lum, invert=False, threshold=128, width=OLED_W):
+    """Una página = 8 filas; cada byte es una columna (bit0 = fila superior).
+    Se rellena a 'width' columnas para que byte i caiga en el índice i del buffer."""
+    if h % 8:
+        sys.exit(f"⚠️  Alto {h} no es múltiplo de 8")
+    if w > width:
+        sys.exit(f"⚠️  Ancho {w} mayor que {width}")
+    out = bytearray()
+    for page in range(h // 8):
+        for x in range(width):
+            byte = 0
+            if x < w:
+                for bit in range(8):
+                    on = lum[page * 8 + bit][x] >= threshold
+                    if on != invert:
+                        byte |= 1 << bit
+            out.append(byte)
+    return bytes(out)
+
+def bytes_from_header(path):
+    """Extrae el primer arreglo { 0x.., ... } de un header C."""
+    text = Path(path).read_text(encoding="utf-8")
+    m = re.search(r"\{([^}]*)\}", text)
+    if not m:
+        sys.exit(f"⚠️  No hallé un arreglo en {path}")
+    return bytes(int(t, 0) for t in re.findall(r"0[xX][0-9a-fA-F]+|\d+", m.group(1)))
+
+# ---------- RLE ----------
+def rle_encode(buf):
+    out = bytearray(struct.pack("<H", len(buf)))
+    i, lit = 0, bytearray()
+
+    def flush():
+        while lit:
+            chunk = lit[:128]
+            out.append(len(chunk) - 1); out.extend(chunk)
+            del lit[:128]
+
+    while i < len(buf):
+        run = 1
+        while i + run < len(buf) and buf[i + run] == buf[i] and run < 129:
+            run += 1
+        if run >= 2:
+            flush()
+            out.append(0x7E + run); out.append(buf[i])
+            i += run
+        else:
+            lit.append(buf[i]); i += 1
+    flush()
+    return bytes(out)
+
+def rle_decode(rle):
+    total = struct.unpack("<H", rle[:2])[0]
+    out, i = bytearray(), 2
+    while len(out) < total:
+        c = rle[i]; i += 1
+        if c < 0x80:
+            out.extend(rle[i:i + c + 1]); i += c + 1
+        else:
+            out.extend(bytes([rle[i]]) * (c - 0x7E)); i += 1
+    return bytes(out)
+
+def render_header(name, w, h, raw, rle, src):
+    up = name.upper()
+    o = ["/* Generado por oled_logo_rle.py desde %s. NO editar a mano. */" % src,
+         "#pragma once",
+         "#include <avr/pgmspace.h>",
+         "#define %s_W %d" % (up, w),
+         "#define %s_H %d" % (up, h),
+         "/* RLE: %d bytes -> %d bytes descomprimidos (ver oled_rle.c) */" % (len(rle), len(raw)),
+         "static const uint8_t PROGMEM %s_rle[] = {" % name]
+    for i in range(0, len(rle), 16):
+        o.append(" " + " ".join("0x%02X," % b for b in rle[i:i + 16]))
+    o.append("};")
+    return "\n".join(o) + "\n"
+
+def main():
+    ap = argparse.ArgumentParser(description="PNG -> RLE para el OLED SSD1306")
+    ap.add_argument("png", nargs="?", help="imagen de entrada (alto múltiplo de 8, ancho <= 128)")
+    ap.add_argument("--from-header", help="toma los bytes crudos de un header existente")
+    ap.add_argument("--name", default="bodegafresh_logo")
+    ap.add_argument("--invert", action="store_true", help="enciende los píxeles oscuros")
+    ap.add_argument("--threshold", type=int, default=128)
+    ap.add_argument("--pad", type=int, default=0, help="rellena con 0x00 hasta N bytes (p. ej. 256 = 2 páginas)")
+    ap.add_argument("--size", help="WxH a declarar con --from-header (p. ej. 112x16)")
+    args = ap.parse_args()
+
+    if args.from_header:
+        raw = bytes_from_header(args.from_header)
+        w, h = (int(v) for v in (args.size or "128x%d" % (len(raw) * 8 // 128)).split("x"))
+        src = Path(args.from_header).name
+    elif args.png:
+        w, h, lum = load_png(args.png)
+        raw = to_pages(w, h, lum, invert=args.invert, threshold=args.threshold)
+        src = Path(args.png).name
+    else:
+        ap.error("indica un PNG o --from-header")
+
+    if args.pad and len(raw) < args.pad:
+        raw = raw + bytes(args.pad - len(raw))
+    rle = rle_encode(raw)
+    assert rle_decode(rle) == raw
+    sys.stdout.write(render_header(args.name, w, h, raw, rle, src))
+    print(f"{args.name}: {len(raw)} -> {len(rle)} bytes", file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
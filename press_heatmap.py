@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+press_heatmap.py
+Lee por Raw HID los contadores de pulsaciones del firmware (keymaps/press_count.c,
+PRESS_COUNT = yes, apagado por defecto en rules.mk) y los muestra como mapa de calor, una grilla por capa con la forma
+de LAYOUT(). Cada pulsación cuenta en la capa de la que salió la tecla: una tecla
+transparente en NAV suma en la capa de abajo que la define.
+
+Los contadores van en el orden de keymap_sparse.h (teclas no transparentes por capa);
+el hash del keymap tiene que coincidir con el del firmware, si no el keymap.c local no
+es el que está flasheado.
+
+Requisitos: hidapi (pip install hidapi).
+Uso (firmware compilado con qmk compile -kb lily58 -km bodegafresh_latam -e PRESS_COUNT=yes):
+  python3 press_heatmap.py                 # todas las capas y las teclas más usadas
+  python3 press_heatmap.py --layer base    # una capa
+  python3 press_heatmap.py --top 20
+  python3 press_heatmap.py --json          # [{capa, fila, columna, keycode, cuenta}]
+  python3 press_heatmap.py --reset         # contadores a cero
+"""
+
+import sys, json, struct, argparse
+
+from keymap_sparse_gen import parse_layers, build, layout_hash, LILY58_LAYOUT_MATRIX, DEFAULT_KEYMAP
+from raw_hid import (RawHid, RawHidError, CMD_PRESS_INFO, CMD_PRESS_READ, CMD_PRESS_RESET,
+                     LILY58_VID, LILY58_PID, parse_int)
+
+# LAYOUT() del Lily58 por fila: (teclas de la mitad izquierda, de la derecha)
+LAYOUT_ROWS = [(6, 6), (6, 6), (6, 6), (7, 7), (4, 4)]
+RAMP = " .:-=+*#%@"
+
+def sparse_keys():
+    """-> ([(capa, fila, columna, keycode)] en el orden de los contadores, hash)"""
+    layers = parse_layers(DEFAULT_KEYMAP.read_text(encoding="utf-8"))
+    codes, rows_bits, _base = build(layers, LILY58_LAYOUT_MATRIX)
+    return codes, layout_hash(rows_bits)
+
+def read_counts(kb):
+    n, fw_hash, _layers, slots, seq = struct.unpack_from("<HHBBB", kb.call(CMD_PRESS_INFO))
+    counts = []
+    while len(counts) < n:
+        reply = kb.call(CMD_PRESS_READ, len(counts) & 0xFF, len(counts) >> 8)
+        k = reply[2]
+        counts += struct.unpack_from(f"<{k}H", reply, 3)
+    return counts, fw_hash, slots, seq
+
+def short(kc):
+    kc = kc.replace("KC_", "")
+    return kc if len(kc) <= 9 else kc[:8] + "…"
+
+def grid(layer, by_pos):
+    """Líneas del mapa de una capa: cuenta y sombra por tecla; · = transparente."""
+    counts = [by_pos.get((layer, r, c)) for r, c in LILY58_LAYOUT_MATRIX]
+    top = max([v for v in counts if v] or [1])
+    out, i = [], 0
+    for left, right in LAYOUT_ROWS:
+        cells = []
+        for v in counts[i:i + left + right]:
+            if v is None:
+                cells.append("    · ")
+            else:
+                cells.append(f"{v:5d}{RAMP[min(len(RAMP) - 1, v * len(RAMP) // (top + 1))]}")
+        # alineadas con la fila de 7 (tecla interior): los pulgares quedan del lado de adentro
+        pad_left, pad_right = "      " * (7 - left), "      " * (right == 6)
+        out.append(pad_left + "".join(cells[:left]) + "   " + pad_right + "".join(cells[left:]))
+        i += left + right
+    return out
+
+def main():
+    ap = argparse.ArgumentParser(description="Mapa de calor de pulsaciones por tecla y capa")
+    ap.add_argument("--vid", type=parse_int, default=LILY58_VID)
+    ap.add_argument("--pid", type=parse_int, default=LILY58_PID)
+    ap.add_argument("--layer", help="solo esta capa (base, sym, ...)")
+    ap.add_argument("--top", type=int, default=10, help="teclas más usadas a listar")
+    ap.add_argument("--json", action="store_true")
+    ap.add_argument("--reset", action="store_true", help="pone los contadores en cero")
+    args = ap.parse_args()
+
+    keys, local_hash = sparse_keys()
+    try:
+        with RawHid(args.vid, args.pid) as kb:
+            if args.reset:
+                kb.call(CMD_PRESS_RESET)
+                print("✅ contadores en cero (la EEPROM se actualiza en la próxima inactividad)")
+                return
+            counts, fw_hash, slots, seq = read_counts(kb)
+    except RawHidError as e:
+        sys.exit(f"❌ {e}")
+    if fw_hash != local_hash or len(counts) != len(keys):
+        sys.exit(f"❌ el firmware es de otro keymap (hash {fw_hash:04x}, keymap.c {local_hash:04x}): "
+                 "flashea el actual o usa el keymap.c con el que se compiló")
+
+    rows = [{"capa": name.lstrip("_").lower(), "fila": r, "columna": c, "keycode": kc, "cuenta": n}
+            for (name, r, c, kc), n in zip(keys, counts)]
+    if args.layer:
+        rows = [x for x in rows if x["capa"] == args.layer.lower()]
+        if not rows:
+            sys.exit(f"❌ capa '{args.layer}' sin teclas propias en keymap.c")
+    if args.json:
+        print(json.dumps(rows, ensure_ascii=False, indent=1))
+        return
+
+    by_pos = {(x["capa"], x["fila"], x["columna"]): x["cuenta"] for x in rows}
+    for layer in dict.fromkeys(x["capa"] for x in rows):
+        total = sum(x["cuenta"] for x in rows if x["capa"] == layer)
+        print(f"── {layer.upper()}: {total} pulsaciones")
+        print("\n".join(grid(layer, by_pos)))
+        print()
+    total = sum(x["cuenta"] for x in rows)
+    print(f"Más usadas (de {total}; EEPROM: {slots} copias, guardado #{seq}):")
+    for x in sorted(rows, key=lambda x: -x["cuenta"])[:args.top]:
+        if x["cuenta"]:
+            print(f"  {x['cuenta']:6d}  {100.0 * x['cuenta'] / max(1, total):5.1f}%  "
+                  f"{x['capa']:<5} {short(x['keycode']):<10} r{x['fila']} c{x['columna']}")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+qmk_keycodes.py
+Keycodes básicos de QMK (HID) y modificadores, para las herramientas que mandan keycodes
+al teclado por Raw HID: "RALT(KC_0)" <-> 0x1427.
+
+Uso (como módulo):
+  from qmk_keycodes import parse, name
+  parse("S(RALT(KC_1))")   # 0x161e
+  name(0x1427)             # 'RALT(KC_0)'
+Uso (CLI):
+  python3 qmk_keycodes.py "RALT(KC_9)" 0x1427
+"""
+
+import re, sys
+
+_BASIC = (
+    ["NO", "TRNS", None, None] +
+    [chr(c) for c in range(ord("A"), ord("Z") + 1)] +
+    ["1", "2", "3", "4", "5", "6", "7", "8", "9", "0",
+     "ENT", "ESC", "BSPC", "TAB", "SPC", "MINS", "EQL", "LBRC", "RBRC", "BSLS",
+     "NUHS", "SCLN", "QUOT", "GRV", "COMM", "DOT", "SLSH", "CAPS"] +
+    [f"F{i}" for i in range(1, 13)] +
+    ["PSCR", "SCRL", "PAUS", "INS", "HOME", "PGUP", "DEL", "END", "PGDN",
+     "RGHT", "LEFT", "DOWN", "UP", "NUM", "PSLS", "PAST", "PMNS", "PPLS", "PENT",
+     "P1", "P2", "P3", "P4", "P5", "P6", "P7", "P8", "P9", "P0", "PDOT", "NUBS", "APP"]
+)
+BASIC = {f"KC_{n}": i for i, n in enumerate(_BASIC) if n}
+BASIC.update({f"KC_{n}": 0xE0 + i for i, n in enumerate(
+    ["LCTL", "LSFT", "LALT", "LGUI", "RCTL", "RSFT", "RALT", "RGUI"])})
+ALIASES = {
+    "KC_ENTER": "KC_ENT", "KC_ESCAPE": "KC_ESC", "KC_SPACE": "KC_SPC", "KC_MINUS": "KC_MINS",
+    "KC_EQUAL": "KC_EQL", "KC_SEMICOLON": "KC_SCLN", "KC_QUOTE": "KC_QUOT", "KC_GRAVE": "KC_GRV",
+    "KC_COMMA": "KC_COMM", "KC_SLASH": "KC_SLSH", "KC_NONUS_HASH": "KC_NUHS",
+    "KC_NONUS_BACKSLASH": "KC_NUBS", "KC_KP_ASTERISK": "KC_PAST", "KC_KP_PLUS": "KC_PPLS",
+    "KC_KP_MINUS": "KC_PMNS", "KC_KP_SLASH": "KC_PSLS", "KC_KP_DOT": "KC_PDOT",
+    "KC_DELETE": "KC_DEL", "KC_RIGHT": "KC_RGHT", "XXXXXXX": "KC_NO",
+}
+NAMES = {v: k for k, v in BASIC.items()}
+
+# bits 8..12 del keycode: Ctrl, Shift, Alt, GUI y "derecho" (afecta a todos)
+MODS = {
+    "C": 0x01, "LCTL": 0x01, "S": 0x02, "LSFT": 0x02, "A": 0x04, "LALT": 0x04, "G": 0x08, "LGUI": 0x08,
+    "RCTL": 0x11, "RSFT": 0x12, "RALT": 0x14, "ALGR": 0x14, "RGUI": 0x18,
+}
+
+def parse(text):
+    """'S(RALT(KC_1))', 'KC_NO', '0x1427' -> int; ValueError si no se reconoce."""
+    t = text.strip()
+    if re.fullmatch(r"0x[0-9a-fA-F]+|\d+", t):
+        return int(t, 0)
+    m = re.fullmatch(r"(\w+)\((.*)\)", t)
+    if m:
+        if m.group(1) not in MODS:
+            raise ValueError(f"modificador desconocido: {m.group(1)}")
+        inner = parse(m.group(2))
+        if inner > 0x1FFF:
+            raise ValueError(f"{t}: solo se aceptan keycodes básicos con mods")
+        return inner | MODS[m.group(1)] << 8
+    t = ALIASES.get(t, t)
+    if t not in BASIC:
+        raise ValueError(f"keycode desconocido: {text.strip()}")
+    return BASIC[t]
+
+def name(code):
+    """int -> expresión QMK (RALT(S(KC_0)) o 0x.... si no es básico)."""
+    basic, mods = code & 0xFF, (code >> 8) & 0x1F
+    if code > 0x1FFF or basic not in NAMES:
+        return f"0x{code:04x}"
+    out = NAMES[basic]
+    prefix = "R" if mods & 0x10 else ""
+    for bit, left, right in ((0x08, "LGUI", "RGUI"), (0x04, "A", "RALT"), (0x02, "S", "RSFT"), (0x01, "C", "RCTL")):
+        if mods & bit:
+            out = f"{right if prefix else left}({out})"
+    return out
+
+if __name__ == "__main__":
+    for arg in sys.argv[1:]:
+        try:
+            v = parse(arg)
+            print(f"{arg:<20} 0x{v:04x}  {name(v)}")
+        except ValueError as e:
+            print(f"❌ {e}")
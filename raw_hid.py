@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+raw_hid.py
+Cliente del protocolo Raw HID del keymap (keymaps/raw_hid_cmd.h), compartido por las
+herramientas que hablan con el teclado en vivo (hotpath_prof.py, symbol_table.py,
+macro_delay.py, press_heatmap.py, ...).
+
+Reportes de 32 bytes: pedido [cmd, args...], respuesta [cmd, estado, datos...].
+La interfaz Raw HID de QMK es la de usage page 0xFF60 / usage 0x61; con Linux hace falta
+permiso sobre /dev/hidraw* (regla udev) o correr como root.
+
+Requisitos: hidapi (pip install hidapi).
+Uso:
+  python3 raw_hid.py                 # lista los teclados con Raw HID y hace ping
+  python3 raw_hid.py --vid 0x04D8 --pid 0xEB2D
+"""
+
+import sys, argparse
+
+USAGE_PAGE, USAGE = 0xFF60, 0x61
+LILY58_VID, LILY58_PID = 0x04D8, 0xEB2D
+REPORT = 32
+
+# keymaps/raw_hid_cmd.h
+CMD_PING = 0x01
+CMD_PROF_INFO, CMD_PROF_READ, CMD_PROF_RESET = 0x10, 0x11, 0x12
+CMD_SYM_INFO, CMD_SYM_GET, CMD_SYM_SET, CMD_SYM_RESET, CMD_SYM_PROFILE = 0x20, 0x21, 0x22, 0x23, 0x24
+CMD_MACRO_DELAY, CMD_MACRO_SAVE, CMD_MACRO_RUN = 0x30, 0x31, 0x32
+CMD_PRESS_INFO, CMD_PRESS_READ, CMD_PRESS_RESET = 0x40, 0x41, 0x42
+STATUS = {0: "ok", 1: "comando no compilado en el firmware", 2: "argumento inválido"}
+
+class RawHidError(Exception):
+    pass
+
+def _hid():
+    try:
+        import hid
+    except ImportError:
+        sys.exit("⚠️  Falta hidapi: pip install hidapi")
+    return hid
+
+def find(vid=LILY58_VID, pid=LILY58_PID):
+    """Interfaces Raw HID que coinciden con vid/pid (None = cualquiera)."""
+    return [d for d in _hid().enumerate()
+            if d.get("usage_page") == USAGE_PAGE and d.get("usage") == USAGE
+            and (vid is None or d["vendor_id"] == vid) and (pid is None or d["product_id"] == pid)]
+
+class RawHid:
+    def __init__(self, vid=LILY58_VID, pid=LILY58_PID, timeout_ms=500):
+        devs = find(vid, pid)
+        if not devs:
+            raise RawHidError("no se encontró la interfaz Raw HID (¿RAW_ENABLE = yes? ¿permisos de hidraw?)")
+        self.dev = _hid().device()
+        self.dev.open_path(devs[0]["path"])
+        self.timeout_ms = timeout_ms
+
+    def close(self):
+        self.dev.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def call(self, cmd, *args):
+        """Manda [cmd, args...] y devuelve los datos de la respuesta (desde el byte 2)."""
+        report = bytes([cmd, *args]).ljust(REPORT, b"\0")
+        self.dev.write(b"\0" + report)             # report ID 0 delante
+        while True:
+            reply = bytes(self.dev.read(REPORT, self.timeout_ms))
+            if not reply:
+                raise RawHidError(f"sin respuesta al comando 0x{cmd:02x}")
+            if reply[0] == cmd:
+                break                              # descarta respuestas viejas
+        if reply[1]:
+            raise RawHidError(f"comando 0x{cmd:02x}: {STATUS.get(reply[1], reply[1])}")
+        return reply[2:]
+
+def parse_int(text):
+    return int(text, 0)
+
+def main():
+    ap = argparse.ArgumentParser(description="Ping por Raw HID al keymap")
+    ap.add_argument("--vid", type=parse_int, default=LILY58_VID)
+    ap.add_argument("--pid", type=parse_int, default=LILY58_PID)
+    args = ap.parse_args()
+
+    for d in find(args.vid, args.pid):
+        print(f"{d['vendor_id']:04x}:{d['product_id']:04x} {d.get('product_string') or ''} {d['path'].decode(errors='replace')}")
+    try:
+        with RawHid(args.vid, args.pid) as kb:
+            print(f"✅ ping: protocolo {kb.call(CMD_PING)[0]}")
+    except RawHidError as e:
+        sys.exit(f"❌ {e}")
+
+if __name__ == "__main__":
+    main()
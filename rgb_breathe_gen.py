@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+rgb_breathe_gen.py
+Genera keymaps/rgb_breathe_table.h para el breathing por tabla (keymaps/rgb_breathe.c):
+  - rgb_breathe_curve[]  brillo por paso, la curva de rgblight_effect_breathing() de QMK
+                         escalada para que su máximo sea RGBLIGHT_LIMIT_VAL (sin meseta
+                         recortada: cada paso cambia el color o no se escribe)
+  - rgb_breathe_rgb[][3] color de cada capa (y de mayúsculas) ya pasado a RGB con V=255,
+                         con hsv_to_rgb() de QMK; el firmware solo escala por el brillo
+
+Los colores van en el orden de enum layer_number, más CAPS al final.
+Uso:
+  python3 rgb_breathe_gen.py                 # -> keymaps/rgb_breathe_table.h
+  python3 rgb_breathe_gen.py --steps 64
+  python3 rgb_breathe_gen.py --check         # falla si el .h está desactualizado
+"""
+
+import re, sys, math, argparse
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+CONFIG_H = HERE / "keymaps" / "config.h"
+OUT = HERE / "keymaps" / "rgb_breathe_table.h"
+
+# (nombre, H, S) igual que apply_layer_lighting(); V lo pone la curva
+COLORS = [
+    ("BASE",   0,   0),   # HSV_WHITE
+    ("SYM",  170, 255),   # HSV_BLUE
+    ("NUM",   85, 255),   # HSV_GREEN
+    ("SYS",  213, 255),   # HSV_MAGENTA
+    ("NAV",   43, 255),   # HSV_YELLOW
+    ("ACC",  128, 255),   # HSV_CYAN
+    ("CAPS",   0, 255),   # HSV_RED
+]
+
+BREATHE_CENTER, BREATHE_MAX = 1.85, 255   # defaults de rgblight
+
+def limit_val():
+    m = re.search(r"#\s*define\s+RGBLIGHT_LIMIT_VAL\s+(\d+)", CONFIG_H.read_text(encoding="utf-8"))
+    return int(m.group(1)) if m else 255
+
+def curve(steps, limit):
+    raw = [(math.exp(math.sin(i / steps * math.pi)) - BREATHE_CENTER / math.e) *
+           (BREATHE_MAX / (math.e - 1 / math.e)) for i in range(steps)]
+    top = max(raw)
+    return [int(round(v * limit / top)) for v in raw]
+
+def hsv_to_rgb(h, s, v):
+    """quantum/color.c, aritmética de 8 bits incluida."""
+    if s == 0:
+        return v, v, v
+    region = h * 6 // 255
+    rem = ((h * 2 - region * 85) * 3) & 0xFF
+    p = (v * (255 - s)) >> 8
+    q = (v * (255 - ((s * rem) >> 8))) >> 8
+    t = (v * (255 - ((s * (255 - rem)) >> 8))) >> 8
+    return {0: (v, t, p), 1: (q, v, p), 2: (p, v, t), 3: (p, q, v), 4: (t, p, v), 6: (v, t, p)}.get(region, (v, p, q))
+
+def render(steps, limit):
+    vals = curve(steps, limit)
+    o = ["/* Generado por rgb_breathe_gen.py. NO editar a mano. */",
+         "#pragma once",
+         "#include <avr/pgmspace.h>",
+         "",
+         "#define RGB_BREATHE_STEPS %d" % steps,
+         "",
+         "/* brillo %d..%d (RGBLIGHT_LIMIT_VAL %d) */" % (min(vals), max(vals), limit),
+         "static const uint8_t PROGMEM rgb_breathe_curve[RGB_BREATHE_STEPS] = {"]
+    for i in range(0, steps, 16):
+        o.append("  " + ", ".join("%3d" % v for v in vals[i:i + 16]) + ",")
+    o += ["};", "",
+          "enum rgb_breathe_color {"]
+    o += ["  RGB_BREATHE_%s," % name for name, _h, _s in COLORS]
+    o += ["  RGB_BREATHE_COLORS", "};", "",
+          "/* RGB con V=255; el firmware escala por la curva */",
+          "static const uint8_t PROGMEM rgb_breathe_rgb[RGB_BREATHE_COLORS][3] = {"]
+    for name, h, s in COLORS:
+        o.append("  [RGB_BREATHE_%s] = { %3d, %3d, %3d },  /* H %d S %d */" % ((name,) + hsv_to_rgb(h, s, 255) + (h, s)))
+    o.append("};")
+    return "\n".join(o) + "\n"
+
+def main():
+    ap = argparse.ArgumentParser(description="Tabla PROGMEM del breathing por capa")
+    ap.add_argument("--steps", type=int, default=128, help="pasos por ciclo (potencia de 2)")
+    ap.add_argument("--out", default=str(OUT))
+    ap.add_argument("--check", action="store_true", help="solo verifica que el .h esté al día")
+    args = ap.parse_args()
+    if args.steps & (args.steps - 1) or not 8 <= args.steps <= 256:
+        ap.error("--steps debe ser potencia de 2 entre 8 y 256")
+
+    text = render(args.steps, limit_val())
+    out = Path(args.out)
+    if args.check:
+        if not out.exists() or out.read_text(encoding="utf-8") != text:
+            print(f"❌ {out.name} desactualizado: python3 rgb_breathe_gen.py"); sys.exit(1)
+        print(f"✅ {out.name} al día.")
+        return
+    out.write_text(text, encoding="utf-8")
+    print(f"{out.name}: {args.steps} pasos + {len(COLORS)} colores = {args.steps + 3 * len(COLORS)} bytes de flash",
+          file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+rgb_emulator.py
+Corre apply_layer_lighting() y la animación BREATHING sobre un modelo de rgblight en el
+host (host/rgblight_mock.c), en tiempo simulado y con un script de teclas, y reporta:
+  - frames WS2812 por segundo (y cuántos repiten el color anterior)
+  - frames con el teclado quieto, reinicios de la animación y mensajes RGBLIGHT_SPLIT
+  - llamadas rgblight_* por pulsación
+  - tiempo estimado de escritura WS2812 por frame y por segundo en cada mitad
+
+Con --variant se compilan varias estrategias (defines distintos) y se comparan lado a lado.
+
+Tiempo WS2812: 24 bits x 1.25 µs por LED + WS2812_TRST_US (280 µs); los LEDs por mitad
+salen de RGBLED_SPLIT en config.h. En AVR la escritura es bit-bang: bloquea el scan.
+
+Requisitos: cc (gcc o clang).
+Uso:
+  python3 rgb_emulator.py                                  # BREATHING de rgblight vs tabla, 10 s
+  python3 rgb_emulator.py --script sim/workloads/typing.txt --ms 30000
+  python3 rgb_emulator.py --variant actual= --variant nueva=MI_ESTRATEGIA   # -DMI_ESTRATEGIA
+  python3 rgb_emulator.py --json                           # una línea JSON por variante
+"""
+
+import re, json, argparse, subprocess
+from pathlib import Path
+
+from oled_emulator import HERE, HOST_DIR, KEYMAP_DIR, build
+
+RGB_BIN = HOST_DIR / "rgb_frames"
+HOST_SRCS = ["rgb_frames.c", "rgblight_mock.c", "oled_mock.c", "qmk_host.c"]
+DEFAULT_SCRIPT = HERE / "sim" / "workloads" / "layers.txt"
+
+WS2812_BIT_US = 1.25
+WS2812_TRST_US = 280
+
+def leds_per_half():
+    text = (KEYMAP_DIR / "config.h").read_text(encoding="utf-8")
+    m = re.search(r"#\s*define\s+RGBLED_SPLIT\s*\{\s*(\d+)\s*,\s*(\d+)\s*\}", text)
+    if m:
+        return int(m.group(1)), int(m.group(2))
+    n = int(re.search(r"#\s*define\s+RGBLED_NUM\s+(\d+)", text).group(1))
+    return n, 0
+
+def frame_us(leds):
+    return leds * 24 * WS2812_BIT_US + WS2812_TRST_US if leds else 0
+
+def run_variant(defines, script, ms):
+    build(RGB_BIN, HOST_SRCS, ["RGBLIGHT_ENABLE", "OLED_ENABLE"] + defines, ["-lm"])
+    out = subprocess.run([str(RGB_BIN), "--script", str(script), "--ms", str(ms)],
+                         capture_output=True, text=True, check=True).stdout
+    return json.loads(out.strip().splitlines()[-1])
+
+def metrics(r):
+    master, slave = leds_per_half()
+    secs = r["ms"] / 1000.0
+    fps = r["frames"] / secs
+    return [
+        ("frames WS2812/s",              f"{fps:.1f}"),
+        ("frames repetidos",             f"{r['redundant']} ({100.0 * r['redundant'] / max(1, r['frames']):.0f}%)"),
+        ("frames en reposo/s",           f"{r['idle_frames'] / secs:.1f}"),
+        ("reinicios de animación",       str(r["restarts"])),
+        ("mensajes RGBLIGHT_SPLIT",      str(r["syncs"])),
+        ("mensajes USER_IDLE_SYNC",      str(r.get("split_msgs", 0))),
+        ("rgblight_* al arrancar",       str(r["boot_calls"])),
+        ("rgblight_* por pulsación",     f"{r['key_calls'] / max(1, r['presses']):.2f}"),
+        ("rgblight_* máx por evento",    str(r["key_calls_max"])),
+        (f"µs por frame ({master} LEDs)", f"{frame_us(master):.0f}"),
+        (f"µs por frame ({slave} LEDs)",  f"{frame_us(slave):.0f}"),
+        ("ms/s bloqueado (maestra)",     f"{fps * frame_us(master) / 1000.0:.1f}"),
+    ]
+
+def main():
+    ap = argparse.ArgumentParser(description="Emulador de rgblight: frecuencia y costo de los efectos")
+    ap.add_argument("--script", default=str(DEFAULT_SCRIPT), help="eventos '<ms> d|u <fila> <col>'")
+    ap.add_argument("--ms", type=int, default=10000, help="tiempo simulado")
+    ap.add_argument("--variant", action="append", default=[],
+                    help="NOMBRE=DEF[,DEF...] (por defecto rgblight= y lut=RGB_BREATHE_LUT); repetible")
+    ap.add_argument("--json", action="store_true")
+    args = ap.parse_args()
+
+    variants = []
+    for spec in args.variant or ["rgblight=", "lut=RGB_BREATHE_LUT"]:
+        name, _, defs = spec.partition("=")
+        variants.append((name or "actual", [d for d in defs.split(",") if d]))
+
+    results = [(name, run_variant(defs, args.script, args.ms)) for name, defs in variants]
+    if args.json:
+        for name, r in results:
+            print(json.dumps(dict(r, variant=name), sort_keys=True))
+        return
+
+    rows = [metrics(r) for _, r in results]
+    print(f"{Path(args.script).name}, {args.ms} ms simulados")
+    print(f"{'':<28}" + "".join(f"{name:>14}" for name, _ in results))
+    for i, (label, _) in enumerate(rows[0]):
+        print(f"{label:<28}" + "".join(f"{row[i][1]:>14}" for row in rows))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,336 @@
+/*
+ * lily58_bench.c
+ * Corre el .elf del Lily58 en simavr con matriz e I2C del OLED simulados, inyecta
+ * eventos de teclado desde un script y mide ciclos por llamada de las funciones
+ * pedidas (inclusivo: desde que el PC entra a la función hasta que el SP vuelve por
+ * encima del marco de entrada, es decir, hasta su RET).
+ *
+ * Con --split corre además la mitad esclava (mismo .elf, sin VBUS) en lockstep,
+ * unida por la línea D2 del soft serial, y registra cada llamada a
+ * transport_execute_transaction(): id, bytes en cada sentido y ciclos.
+ *
+ * Lo compila y ejecuta simavr_bench.py; uso directo:
+ *   lily58_bench fw.elf --ms 3000 --script typing.txt --sym matrix_scan=0x1234 ...
+ *   lily58_bench fw.elf --split --txn 0x2345 --script layers.txt ...
+ *   lily58_bench fw.elf --mhz 8 ...   (reloj; si no, el de la sección .mmcu del .elf o 16 MHz)
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "sim_irq.h"
+#include "avr_ioport.h"
+#include "avr_twi.h"
+#include "avr_usb.h"
+
+#define MAX_SYMS   16
+#define MAX_EVENTS 4096
+#define MAX_TXN_ID 32
+#define ROWS 5                 /* filas por mitad; las filas 5..9 del script van a la esclava */
+#define COLS 6
+#define OLED_ADDR  (0x3C << 1)
+
+/* ATmega32u4: registros de PORTD en espacio de datos (soft serial en D2) */
+#define REG_DDRD  0x2A
+#define REG_PORTD 0x2B
+#define SERIAL_BIT 2
+
+/* Pines del Lily58 rev1 (iguales en ambas mitades, DIODE_DIRECTION COL2ROW) */
+static const struct { char port; int bit; } row_pins[ROWS] = { {'C',6}, {'D',7}, {'E',6}, {'B',4}, {'B',5} };
+static const struct { char port; int bit; } col_pins[COLS] = { {'F',6}, {'F',7}, {'B',1}, {'B',3}, {'B',2}, {'B',6} };
+
+typedef struct half half_t;
+typedef struct { half_t *half; int row; } row_ctx_t;
+
+struct half {
+  avr_t *avr;
+  int pressed[ROWS][COLS];
+  int row_low[ROWS];
+  avr_irq_t *col_irq[COLS];
+  avr_irq_t *serial_irq;
+  row_ctx_t row_ctx[ROWS];
+};
+
+typedef struct {
+  const char *name;
+  uint32_t addr;                 /* dirección en bytes (avr-nm) */
+  int active;
+  uint16_t entry_sp;
+  avr_cycle_count_t start, min, max, total;
+  uint32_t calls;
+} probe_t;
+
+typedef struct {
+  uint32_t calls, bytes_out, bytes_in;
+  avr_cycle_count_t cycles;
+} txn_stat_t;
+
+typedef struct { uint32_t ms; int down, row, col; } event_t;
+
+static half_t halves[2];       /* [0] maestra (VBUS), [1] esclava (solo con --split) */
+static int nhalves = 1;
+static probe_t probes[MAX_SYMS];
+static int nprobes;
+static event_t events[MAX_EVENTS];
+static int nevents;
+
+static probe_t txn_probe = { .name = "transport_execute_transaction" };
+static int txn_id;
+static uint16_t txn_out, txn_in;
+static txn_stat_t txn_stats[MAX_TXN_ID];
+
+static avr_irq_t *twi_in[2];
+static int oled_selected[2];
+static uint32_t oled_bytes, oled_transfers;
+static int serial_level = 1;
+
+/* ---------- Matriz ---------- */
+static void update_cols(half_t *h) {
+  for (int c = 0; c < COLS; c++) {
+    int level = 1;                                   /* pull-up */
+    for (int r = 0; r < ROWS; r++)
+      if (h->row_low[r] && h->pressed[r][c]) level = 0;
+    avr_raise_irq(h->col_irq[c], level);
+  }
+}
+
+static void row_changed(avr_irq_t *irq, uint32_t value, void *param) {
+  row_ctx_t *ctx = param;
+  ctx->half->row_low[ctx->row] = (value == 0);
+  update_cols(ctx->half);
+}
+
+static void setup_matrix(half_t *h) {
+  for (int r = 0; r < ROWS; r++) {
+    h->row_ctx[r].half = h;
+    h->row_ctx[r].row = r;
+    avr_irq_t *irq = avr_io_getirq(h->avr, AVR_IOCTL_IOPORT_GETIRQ(row_pins[r].port), row_pins[r].bit);
+    avr_irq_register_notify(irq, row_changed, &h->row_ctx[r]);
+  }
+  for (int c = 0; c < COLS; c++)
+    h->col_irq[c] = avr_io_getirq(h->avr, AVR_IOCTL_IOPORT_GETIRQ(col_pins[c].port), col_pins[c].bit);
+  update_cols(h);
+}
+
+/* ---------- OLED (esclavo I2C que solo hace ACK; cuenta bytes de la maestra) ---------- */
+static void twi_out(avr_irq_t *irq, uint32_t value, void *param) {
+  int idx = (int)(intptr_t)param;
+  avr_twi_msg_irq_t v;
+  v.u.v = value;
+  if (v.u.twi.msg & TWI_COND_STOP) oled_selected[idx] = 0;
+  if (v.u.twi.msg & TWI_COND_START) {
+    oled_selected[idx] = ((v.u.twi.addr & ~1) == OLED_ADDR);
+    if (oled_selected[idx]) {
+      if (idx == 0) oled_transfers++;
+      avr_raise_irq(twi_in[idx], avr_twi_irq_msg(TWI_COND_ACK, v.u.twi.addr, 1));
+    }
+  }
+  if (oled_selected[idx] && (v.u.twi.msg & TWI_COND_WRITE)) {
+    if (idx == 0) oled_bytes++;
+    avr_raise_irq(twi_in[idx], avr_twi_irq_msg(TWI_COND_ACK, v.u.twi.addr, 1));
+  }
+}
+
+/* ---------- Soft serial: línea D2 con pull-up, baja si alguna mitad la maneja en 0 ---------- */
+static int drives_low(avr_t *a) {
+  uint8_t m = 1 << SERIAL_BIT;
+  return (a->data[REG_DDRD] & m) && !(a->data[REG_PORTD] & m);
+}
+
+static void update_serial(void) {
+  int level = !(drives_low(halves[0].avr) || drives_low(halves[1].avr));
+  if (level == serial_level) return;
+  serial_level = level;
+  avr_raise_irq(halves[0].serial_irq, level);
+  avr_raise_irq(halves[1].serial_irq, level);
+}
+
+/* ---------- Sondas (solo en la maestra) ---------- */
+static inline uint16_t sp(avr_t *a) {
+  return a->data[R_SPL] | (a->data[R_SPH] << 8);
+}
+
+static int probe_update(probe_t *p, avr_t *a, avr_cycle_count_t *elapsed) {
+  if (!p->addr) return 0;
+  if (!p->active && a->pc == p->addr) {
+    p->active = 1;
+    p->entry_sp = sp(a);
+    p->start = a->cycle;
+    return 1;
+  }
+  if (p->active && sp(a) > p->entry_sp) {
+    avr_cycle_count_t d = a->cycle - p->start;
+    p->active = 0;
+    p->calls++;
+    p->total += d;
+    if (!p->min || d < p->min) p->min = d;
+    if (d > p->max) p->max = d;
+    if (elapsed) *elapsed = d;
+    return 2;
+  }
+  return 0;
+}
+
+static void probe_step(avr_t *a) {
+  for (int i = 0; i < nprobes; i++) probe_update(&probes[i], a, NULL);
+
+  /* transport_execute_transaction(int8_t id, const void *i2t, uint16_t i2t_len,
+   *                               void *t2i, uint16_t t2i_len): r24, r22:23, r20:21, r18:19, r16:17 */
+  avr_cycle_count_t d = 0;
+  switch (probe_update(&txn_probe, a, &d)) {
+    case 1:
+      txn_id  = (int8_t)a->data[24];
+      txn_out = a->data[20] | (a->data[21] << 8);
+      txn_in  = a->data[16] | (a->data[17] << 8);
+      break;
+    case 2:
+      if (txn_id >= 0 && txn_id < MAX_TXN_ID) {
+        txn_stats[txn_id].calls++;
+        txn_stats[txn_id].bytes_out += txn_out;
+        txn_stats[txn_id].bytes_in  += txn_in;
+        txn_stats[txn_id].cycles    += d;
+      }
+      break;
+  }
+}
+
+/* ---------- Script de eventos: "<ms> d|u <fila> <col>" ---------- */
+static void load_script(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) { perror(path); exit(1); }
+  char line[256];
+  while (fgets(line, sizeof line, f) && nevents < MAX_EVENTS) {
+    char *hash = strchr(line, '#');
+    if (hash) *hash = 0;
+    event_t e; char kind;
+    if (sscanf(line, "%u %c %d %d", &e.ms, &kind, &e.row, &e.col) != 4) continue;
+    if (e.row < 0 || e.row >= ROWS * nhalves || e.col < 0 || e.col >= COLS) {
+      fprintf(stderr, "evento fuera de la matriz simulada (¿falta --split?): %s\n", line);
+      continue;
+    }
+    e.down = (kind == 'd');
+    events[nevents++] = e;
+  }
+  fclose(f);
+}
+
+static void report(uint32_t ms, int json) {
+  avr_t *a = halves[0].avr;
+  double mhz = a->frequency / 1e6;
+  if (json) {
+    printf("{\"ms\": %u, \"f_cpu\": %u, \"oled_i2c_bytes\": %u, \"oled_i2c_transfers\": %u, \"probes\": {", ms,
+           (unsigned)a->frequency, oled_bytes, oled_transfers);
+    for (int i = 0; i < nprobes; i++) {
+      probe_t *p = &probes[i];
+      printf("%s\"%s\": {\"calls\": %u, \"min\": %llu, \"avg\": %llu, \"max\": %llu}", i ? ", " : "", p->name, p->calls,
+             (unsigned long long)p->min, (unsigned long long)(p->calls ? p->total / p->calls : 0),
+             (unsigned long long)p->max);
+    }
+    printf("}, \"transactions\": {");
+    for (int id = 0, first = 1; id < MAX_TXN_ID; id++) {
+      txn_stat_t *t = &txn_stats[id];
+      if (!t->calls) continue;
+      printf("%s\"%d\": {\"calls\": %u, \"bytes_out\": %u, \"bytes_in\": %u, \"cycles\": %llu}", first ? "" : ", ", id,
+             t->calls, t->bytes_out, t->bytes_in, (unsigned long long)t->cycles);
+      first = 0;
+    }
+    printf("}}\n");
+    return;
+  }
+  printf("%-24s %8s %10s %10s %10s %9s\n", "función", "llamadas", "min", "avg", "max", "avg µs");
+  for (int i = 0; i < nprobes; i++) {
+    probe_t *p = &probes[i];
+    unsigned long long avg = p->calls ? p->total / p->calls : 0;
+    printf("%-24s %8u %10llu %10llu %10llu %9.1f\n", p->name, p->calls, (unsigned long long)p->min, avg,
+           (unsigned long long)p->max, avg / mhz);
+  }
+  if (nhalves == 2) {
+    printf("\n%-6s %8s %10s %10s %10s\n", "txn id", "llamadas", "bytes out", "bytes in", "µs total");
+    for (int id = 0; id < MAX_TXN_ID; id++) {
+      txn_stat_t *t = &txn_stats[id];
+      if (t->calls)
+        printf("%-6d %8u %10u %10u %10.1f\n", id, t->calls, t->bytes_out, t->bytes_in, t->cycles / mhz);
+    }
+  }
+  printf("\nOLED I2C: %u bytes en %u transferencias (%u ms simulados)\n", oled_bytes, oled_transfers, ms);
+}
+
+static uint32_t f_cpu;   // --mhz; 0 = el del .elf
+
+static half_t *make_half(int idx, elf_firmware_t *fw) {
+  half_t *h = &halves[idx];
+  h->avr = avr_make_mcu_by_name("atmega32u4");
+  if (!h->avr) { fprintf(stderr, "simavr sin soporte para atmega32u4\n"); exit(1); }
+  avr_init(h->avr);
+  h->avr->frequency = f_cpu ? f_cpu : fw->frequency ? fw->frequency : 16000000;
+  avr_load_firmware(h->avr, fw);
+  setup_matrix(h);
+  twi_in[idx] = avr_io_getirq(h->avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_INPUT);
+  avr_irq_register_notify(avr_io_getirq(h->avr, AVR_IOCTL_TWI_GETIRQ(0), TWI_IRQ_OUTPUT), twi_out,
+                          (void *)(intptr_t)idx);
+  h->serial_irq = avr_io_getirq(h->avr, AVR_IOCTL_IOPORT_GETIRQ('D'), SERIAL_BIT);
+  return h;
+}
+
+int main(int argc, char **argv) {
+  const char *elf = NULL, *script = NULL;
+  uint32_t run_ms = 2000;
+  int json = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--ms") && i + 1 < argc) run_ms = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--script") && i + 1 < argc) script = argv[++i];
+    else if (!strcmp(argv[i], "--mhz") && i + 1 < argc) f_cpu = (uint32_t)(strtod(argv[++i], NULL) * 1e6);
+    else if (!strcmp(argv[i], "--json")) json = 1;
+    else if (!strcmp(argv[i], "--split")) nhalves = 2;
+    else if (!strcmp(argv[i], "--txn") && i + 1 < argc) txn_probe.addr = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--sym") && i + 1 < argc && nprobes < MAX_SYMS) {
+      char *spec = argv[++i], *eq = strchr(spec, '=');
+      if (!eq) continue;
+      *eq = 0;
+      probes[nprobes].name = spec;
+      probes[nprobes].addr = strtoul(eq + 1, NULL, 0);
+      nprobes++;
+    } else elf = argv[i];
+  }
+  if (!elf) {
+    fprintf(stderr, "uso: %s fw.elf [--ms N] [--mhz F] [--script f] [--json] [--split --txn 0xaddr] --sym nombre=0xaddr ...\n",
+            argv[0]);
+    return 1;
+  }
+  if (script) load_script(script);
+
+  elf_firmware_t fw = {{0}};
+  if (elf_read_firmware(elf, &fw)) { fprintf(stderr, "no pude leer %s\n", elf); return 1; }
+
+  half_t *master = make_half(0, &fw);
+  /* VBUS presente: esta mitad se detecta como maestra; la esclava no lo recibe */
+  avr_raise_irq(avr_io_getirq(master->avr, AVR_IOCTL_USB_GETIRQ(), USB_IRQ_ATTACH), 1);
+  if (nhalves == 2) make_half(1, &fw);
+
+  avr_cycle_count_t per_ms = master->avr->frequency / 1000, end = (avr_cycle_count_t)run_ms * per_ms;
+  int next = 0;
+  while (master->avr->cycle < end) {
+    /* lockstep: avanza la mitad más atrasada para que el soft serial vea tiempos reales */
+    half_t *h = (nhalves == 2 && halves[1].avr->cycle < master->avr->cycle) ? &halves[1] : master;
+    uint32_t now_ms = master->avr->cycle / per_ms;
+    while (next < nevents && events[next].ms <= now_ms) {
+      event_t *e = &events[next++];
+      half_t *dst = &halves[e->row / ROWS];
+      dst->pressed[e->row % ROWS][e->col] = e->down;
+      update_cols(dst);
+    }
+    int state = avr_run(h->avr);
+    if (state == cpu_Done || state == cpu_Crashed) {
+      fprintf(stderr, "la CPU %s se detuvo (estado %d) en %u ms\n", h == master ? "maestra" : "esclava", state, now_ms);
+      break;
+    }
+    if (nhalves == 2) update_serial();
+    if (h == master) probe_step(master->avr);
+  }
+  report(run_ms, json);
+  return 0;
+}
@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+simavr_bench.py
+Benchmark de ciclos del firmware Lily58 en simavr (sin hardware): compila sim/lily58_bench.c,
+corre el .elf con la matriz y el OLED I2C simulados, inyecta un script de teclas y reporta
+ciclos por llamada de matrix_scan, process_record_user, oled_task_user y apply_layer_lighting.
+
+Con --split simula también la mitad esclava unida por D2 (soft serial) y reporta, por
+transacción del split (PUT_LAYER_STATE, PUT_MODS, PUT_RGBLIGHT, ...), bytes y µs por scan.
+Los nombres de las transacciones salen de quantum/split_common/transaction_id_define.h
+evaluado con los defines de config.h/rules.mk (--qmk-home o 'qmk config user.qmk_home').
+
+El .elf debe compilarse con SIMAVR_BENCH=yes (ver rules.mk): sin LTO y con
+apply_layer_lighting marcada noinline, para que cada función medida tenga su símbolo.
+
+Requisitos: simavr (libsimavr-dev), avr-binutils, cc; QMK si se usa --compile.
+Uso:
+  python3 simavr_bench.py --compile                          # compila y mide
+  python3 simavr_bench.py --elf fw.elf --ms 3000
+  python3 simavr_bench.py --elf fw.elf --save-baseline sim/baseline.json
+  python3 simavr_bench.py --elf fw.elf --baseline sim/baseline.json --tolerance 10   # para CI
+  python3 simavr_bench.py --elf fw.elf --split --script sim/workloads/layers.txt
+  python3 simavr_bench.py --elf fw.elf --mhz 8               # Pro Micro de 3.3 V / 8 MHz
+
+El reloj simulado es el F_CPU del firmware: QMK no lo deja en el .elf, así que se toma de
+--mhz, o de la sección .mmcu si el .elf la tiene, o 16 MHz (Pro Micro de 5 V). Los µs
+del reporte usan ese mismo reloj.
+"""
+
+import os, re, sys, json, shlex, shutil, argparse, subprocess
+from pathlib import Path
+
+HERE = Path(__file__).resolve().parent
+SIM_DIR = HERE / "sim"
+BENCH_SRC = SIM_DIR / "lily58_bench.c"
+BENCH_BIN = SIM_DIR / "lily58_bench"
+DEFAULT_SCRIPT = SIM_DIR / "workloads" / "typing.txt"
+
+PROBES = ["keyboard_task", "matrix_scan", "process_record_user", "oled_task_user", "apply_layer_lighting"]
+SPLIT_PROBES = ["transactions_master"]
+TXN_SYMBOL = "transport_execute_transaction"
+KEYMAP_DIR = HERE / "keymaps"
+
+def run(cmd, **kw):
+    try:
+        return subprocess.check_output(cmd, stderr=subprocess.STDOUT, **kw).decode("utf-8", errors="replace")
+    except FileNotFoundError:
+        sys.exit(f"⚠️  No se encontró '{cmd[0]}'.")
+    except subprocess.CalledProcessError as e:
+        sys.stderr.write(e.output.decode("utf-8", errors="replace"))
+        sys.exit(e.returncode)
+
+def build_bench():
+    """Compila el simulador si falta o si el .c es más nuevo."""
+    if BENCH_BIN.exists() and BENCH_BIN.stat().st_mtime >= BENCH_SRC.stat().st_mtime:
+        return
+    flags = []
+    if shutil.which("pkg-config"):
+        try:
+            flags = shlex.split(run(["pkg-config", "--cflags", "--libs", "simavr"]))
+        except SystemExit:
+            flags = []
+    if not flags:
+        flags = ["-I/usr/include/simavr", "-I/usr/local/include/simavr", "-lsimavr", "-lelf"]
+    cc = os.environ.get("CC", "cc")
+    run([cc, "-O2", "-Wall", str(BENCH_SRC), "-o", str(BENCH_BIN)] + flags)
+
+def compile_firmware(kb, km):
+    run(["qmk", "compile", "-kb", kb, "-km", km, "-e", "SIMAVR_BENCH=yes"])
+    home = run(["qmk", "config", "user.qmk_home"]).strip().split("=", 1)[-1]
+    cands = sorted((Path(home) / ".build").glob(f"*{km}*.elf"))
+    if not cands:
+        sys.exit("⚠️  No encontré el .elf compilado en .build/")
+    return cands[0]
+
+def symbol_addrs(elf, nm_tool, wanted):
+    addrs = {}
+    for line in run([nm_tool, str(elf)]).splitlines():
+        parts = line.split()
+        if len(parts) == 3 and parts[1] in "tT":
+            base = re.sub(r"\.(lto_priv|constprop|isra|part)\.\d+.*$", "", parts[2])
+            if base in wanted and base not in addrs:
+                addrs[base] = int(parts[0], 16)
+    return addrs
+
+# ---------- Nombres de transacciones del split ----------
+def active_defines():
+    """Defines de config.h más los X_ENABLE = yes de rules.mk (como los ve QMK)."""
+    defs = {"SPLIT_KEYBOARD"}
+    cfg = KEYMAP_DIR / "config.h"
+    if cfg.exists():
+        defs |= set(re.findall(r"^\s*#\s*define\s+(\w+)", cfg.read_text(encoding="utf-8"), re.M))
+    rules = KEYMAP_DIR / "rules.mk"
+    if rules.exists():
+        defs |= {k for k, v in re.findall(r"^\s*(\w+_ENABLE)\s*=\s*(\w+)", rules.read_text(encoding="utf-8"), re.M)
+                 if v == "yes"}
+    return defs
+
+def transaction_names(qmk_home):
+    """Evalúa los #if de transaction_id_define.h y devuelve {id: nombre}."""
+    path = Path(qmk_home) / "quantum" / "split_common" / "transaction_id_define.h"
+    if not path.exists():
+        return {}
+    defs = active_defines()
+
+    def cond(expr):
+        expr = re.sub(r"defined\s*\(\s*(\w+)\s*\)", lambda m: str(m.group(1) in defs), expr)
+        expr = re.sub(r"defined\s+(\w+)", lambda m: str(m.group(1) in defs), expr)
+        expr = expr.replace("&&", " and ").replace("||", " or ").replace("!", " not ")
+        expr = re.sub(r"\b(?!True\b|False\b|and\b|or\b|not\b)[A-Za-z_]\w*\b", "False", expr)
+        try:
+            return bool(eval(expr, {}, {}))
+        except Exception:
+            return False
+
+    # SPLIT_TRANSACTION_IDS_USER se expande a los ids del usuario (config.h)
+    cfg = KEYMAP_DIR / "config.h"
+    user_ids = re.findall(r"^\s*#\s*define\s+SPLIT_TRANSACTION_IDS_USER\s+(.+)$",
+                          cfg.read_text(encoding="utf-8"), re.M) if cfg.exists() else []
+    user_ids = [i.strip() for i in user_ids[0].split(",")] if user_ids else []
+
+    names, stack, body = {}, [], False
+    for raw in path.read_text(encoding="utf-8").splitlines():
+        line = re.sub(r"//.*|/\*.*?\*/", "", raw).strip()
+        if line.startswith("enum serial_transaction_id"):
+            body = True; continue
+        if not body:
+            continue
+        if line.startswith("};"):
+            break
+        m = re.match(r"#\s*(ifdef|ifndef|if|elif|else|endif)\b\s*(.*)", line)
+        if m:
+            kw, expr = m.groups()
+            if kw == "ifdef":    stack.append(expr.strip() in defs)
+            elif kw == "ifndef": stack.append(expr.strip() not in defs)
+            elif kw == "if":     stack.append(cond(expr))
+            elif kw == "elif":   stack[-1] = (not stack[-1]) and cond(expr)
+            elif kw == "else":   stack[-1] = not stack[-1]
+            elif kw == "endif":  stack.pop()
+            continue
+        if all(stack):
+            for ident in re.findall(r"([A-Z][A-Z0-9_]*)\s*,", line):
+                for name in (user_ids if ident == "SPLIT_TRANSACTION_IDS_USER" else [ident]):
+                    names[len(names)] = name
+    return names
+
+def qmk_home_dir(arg):
+    if arg:
+        return arg
+    try:
+        return run(["qmk", "config", "user.qmk_home"]).strip().split("=", 1)[-1]
+    except SystemExit:
+        return ""
+
+def compare(result, baseline, tolerance):
+    """Devuelve lista de regresiones (avg de ciclos > baseline * (1 + tol%))."""
+    bad = []
+    if baseline.get("f_cpu", result["f_cpu"]) != result["f_cpu"]:
+        # las cuentas por ms (scans, llamadas) cambian con el reloj: no son comparables
+        bad.append(f"f_cpu: {result['f_cpu']} Hz, el baseline es de {baseline['f_cpu']} Hz (usa --mhz)")
+    for name, cur in result["probes"].items():
+        ref = baseline.get("probes", {}).get(name)
+        if not ref or not ref.get("avg"):
+            continue
+        limit = ref["avg"] * (1 + tolerance / 100.0)
+        if cur["avg"] > limit:
+            bad.append(f"{name}: avg {cur['avg']} > {ref['avg']} (+{tolerance}%)")
+    ref_oled = baseline.get("oled_i2c_bytes")
+    if ref_oled and result["oled_i2c_bytes"] > ref_oled * (1 + tolerance / 100.0):
+        bad.append(f"oled_i2c_bytes: {result['oled_i2c_bytes']} > {ref_oled} (+{tolerance}%)")
+    return bad
+
+def main():
+    ap = argparse.ArgumentParser(description="Benchmark de ciclos del Lily58 en simavr")
+    ap.add_argument("--elf", help=".elf compilado con SIMAVR_BENCH=yes")
+    ap.add_argument("--compile", action="store_true")
+    ap.add_argument("-kb", default="lily58")
+    ap.add_argument("-km", default="bodegafresh_latam")
+    ap.add_argument("--nm", default="avr-nm")
+    ap.add_argument("--ms", type=int, default=3000, help="tiempo simulado")
+    ap.add_argument("--mhz", type=float, help="F_CPU del firmware (por defecto el del .elf o 16)")
+    ap.add_argument("--script", default=str(DEFAULT_SCRIPT), help="eventos '<ms> d|u <fila> <col>'")
+    ap.add_argument("--split", action="store_true", help="simula también la mitad esclava (soft serial D2)")
+    ap.add_argument("--qmk-home", help="para nombrar las transacciones del split")
+    ap.add_argument("--baseline", help="JSON previo; falla si hay regresión")
+    ap.add_argument("--tolerance", type=float, default=10.0, help="%% permitido sobre el baseline")
+    ap.add_argument("--save-baseline", help="guarda el resultado como baseline")
+    args = ap.parse_args()
+
+    elf = compile_firmware(args.kb, args.km) if args.compile else Path(args.elf or "")
+    if not elf.is_file():
+        ap.error("indica --elf o --compile")
+    build_bench()
+
+    probes = PROBES + (SPLIT_PROBES if args.split else [])
+    addrs = symbol_addrs(elf, args.nm, probes + [TXN_SYMBOL])
+    for name in probes:
+        if name not in addrs:
+            print(f"⚠️  {name}: sin símbolo (¿inlineado? compila con SIMAVR_BENCH=yes)", file=sys.stderr)
+    cmd = [str(BENCH_BIN), str(elf), "--ms", str(args.ms), "--script", args.script, "--json"]
+    if args.mhz:
+        cmd += ["--mhz", str(args.mhz)]
+    for name in probes:
+        if name in addrs:
+            cmd += ["--sym", f"{name}=0x{addrs[name]:x}"]
+    if args.split:
+        if TXN_SYMBOL not in addrs:
+            sys.exit(f"⚠️  {TXN_SYMBOL} no está en el .elf; ¿build sin split?")
+        cmd += ["--split", "--txn", f"0x{addrs[TXN_SYMBOL]:x}"]
+    result = json.loads(run(cmd).strip().splitlines()[-1])
+
+    mhz = result["f_cpu"] / 1e6
+    print(f"reloj simulado: {mhz:g} MHz\n")
+    print(f"{'función':<24} {'llamadas':>8} {'min':>10} {'avg':>10} {'max':>10} {'avg µs':>9}")
+    for name, p in result["probes"].items():
+        print(f"{name:<24} {p['calls']:>8} {p['min']:>10} {p['avg']:>10} {p['max']:>10} {p['avg'] / mhz:>9.1f}")
+    print(f"\nOLED I2C: {result['oled_i2c_bytes']} bytes en {result['oled_i2c_transfers']} transferencias "
+          f"({result['ms']} ms simulados)")
+
+    if args.split:
+        names = transaction_names(qmk_home_dir(args.qmk_home))
+        scans = max(1, result["probes"].get("matrix_scan", {}).get("calls", 0))
+        print(f"\n{'transacción':<28} {'llamadas':>8} {'B/scan':>8} {'µs/scan':>8} {'µs/llamada':>10}")
+        tot_b = tot_us = 0.0
+        for tid, t in sorted(result["transactions"].items(), key=lambda kv: int(kv[0])):
+            b = (t["bytes_out"] + t["bytes_in"]) / scans
+            us = t["cycles"] / mhz / scans
+            tot_b += b; tot_us += us
+            print(f"{names.get(int(tid), 'id ' + tid):<28} {t['calls']:>8} {b:>8.2f} {us:>8.1f} "
+                  f"{t['cycles'] / mhz / t['calls']:>10.1f}")
+        print(f"{'TOTAL por scan':<28} {'':>8} {tot_b:>8.2f} {tot_us:>8.1f}   ({scans} scans)")
+
+    if args.save_baseline:
+        Path(args.save_baseline).write_text(json.dumps(result, indent=2, sort_keys=True) + "\n", encoding="utf-8")
+        print(f"Baseline guardado en {args.save_baseline}")
+    if args.baseline:
+        bad = compare(result, json.loads(Path(args.baseline).read_text(encoding="utf-8")), args.tolerance)
+        if bad:
+            print("\n❌ Regresiones:\n  " + "\n  ".join(bad)); sys.exit(1)
+        print("\n✅ Sin regresiones respecto al baseline.")
+
+if __name__ == "__main__":
+    main()
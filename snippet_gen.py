@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+snippet_gen.py
+Genera keymaps/snippet_data.h para el motor de snippets (keymaps/snippets.c) desde
+assets/snippets.txt, comprimido con un diccionario de pares (byte pair encoding):
+  - snippet_dict[][2]   par de símbolos de cada código 0x80..0xFF; un símbolo es un
+                        carácter ASCII (< 0x80) u otro código del diccionario
+  - snippet_data[]      los snippets seguidos, ya con los códigos
+  - snippet_offset[]    inicio de cada snippet en snippet_data[] (+1 al final)
+
+Se reemplaza el par más repetido mientras ahorre flash (aparece 3 veces o más) o hasta
+llenar los 128 códigos. El firmware expande un código por vez con una pila de
+SNIPPET_STACK bytes, así que decodificar cuesta lo mismo con 5 snippets que con 50.
+
+Los nombres van en el mismo orden que los SNIP_* de enum custom_keycodes
+(bodegafresh_keycodes.h). Solo ASCII que escribe send_latam.c: imprimibles (los signos
+salen de la tabla de símbolos del perfil activo), Enter, Tab, Backspace, Esc y Supr.
+
+Uso:
+  python3 snippet_gen.py                   # -> keymaps/snippet_data.h
+  python3 snippet_gen.py --check           # falla si el .h está desactualizado
+  python3 snippet_gen.py --show            # diccionario y snippets expandidos
+"""
+
+import re, sys, argparse
+from collections import Counter
+from pathlib import Path
+
+from keymap_sparse_gen import strip_comments
+
+HERE = Path(__file__).resolve().parent
+SRC = HERE / "assets" / "snippets.txt"
+KEYCODES_H = HERE / "keymaps" / "bodegafresh_keycodes.h"
+OUT = HERE / "keymaps" / "snippet_data.h"
+
+FIRST_CODE, MAX_CODES = 0x80, 128
+ESCAPES = {"n": "\n", "t": "\t", "\\": "\\"}
+# lo que escribe latam_send_char() (send_latam.c)
+SENDABLE = set(range(0x20, 0x7F)) | {0x08, 0x09, 0x0A, 0x1B, 0x7F}
+
+def parse_snippets(text):
+    """[(NOMBRE, texto)] en el orden del archivo."""
+    out = []
+    for n, line in enumerate(text.splitlines(), 1):
+        if not line.strip() or line.startswith("#"):
+            continue
+        m = re.match(r"^(\w+)\s+(.*)$", line)
+        if not m:
+            sys.exit(f"❌ snippets.txt:{n}: se espera 'NOMBRE  texto'")
+        body = re.sub(r"\\(.)", lambda e: ESCAPES.get(e.group(1), e.group(0)), m.group(2).rstrip())
+        out.append((m.group(1), body))
+    return out
+
+def enum_snippets():
+    """Nombres SNIP_* de enum custom_keycodes, en orden."""
+    src = strip_comments(KEYCODES_H.read_text(encoding="utf-8"))
+    body = re.search(r"enum\s+custom_keycodes\s*\{([^}]*)\}", src).group(1)
+    return re.findall(r"\bSNIP_(\w+)", body)
+
+def compress(texts):
+    """BPE: -> (diccionario [(a, b)], [lista de símbolos por snippet])."""
+    seqs = [[ord(c) for c in t] for t in texts]
+    pairs = []
+    while len(pairs) < MAX_CODES:
+        count = Counter()
+        for s in seqs:
+            prev = None
+            for pair in zip(s, s[1:]):
+                if pair == prev and pair[0] == pair[1]:
+                    prev = None          # "aaa" tiene un solo (a, a) reemplazable
+                    continue
+                count[pair] += 1
+                prev = pair
+        if not count:
+            break
+        pair, n = max(count.items(), key=lambda kv: (kv[1], -kv[0][0], -kv[0][1]))
+        if n < 3:                       # 2 bytes de diccionario: con 2 usos no ahorra
+            break
+        code = FIRST_CODE + len(pairs)
+        pairs.append(pair)
+        for k, s in enumerate(seqs):
+            out, i = [], 0
+            while i < len(s):
+                if i < len(s) - 1 and (s[i], s[i + 1]) == pair:
+                    out.append(code); i += 2
+                else:
+                    out.append(s[i]); i += 1
+            seqs[k] = out
+    return pairs, seqs
+
+def decode(pairs, seq):
+    """Como snippet_next() del firmware: -> (texto, máxima altura de la pila)."""
+    out, stack, top = [], [], 0
+    for b in seq:
+        stack.append(b)
+        while stack:
+            top = max(top, len(stack))
+            b = stack.pop()
+            if b < FIRST_CODE:
+                out.append(chr(b))
+            else:
+                stack += [pairs[b - FIRST_CODE][1], pairs[b - FIRST_CODE][0]]
+    return "".join(out), top
+
+def label(b):
+    if b >= FIRST_CODE:
+        return "#%d" % (b - FIRST_CODE)
+    return {0x0A: "\\n", 0x09: "\\t", 0x20: "' '"}.get(b, chr(b))
+
+def c_comment(text):
+    return text.replace("\\", "\\\\").replace("\n", "\\n").replace("\t", "\\t").replace("*/", "* /")
+
+def render(snippets, pairs, seqs, stack):
+    data = [b for s in seqs for b in s]
+    offsets = [0]
+    for s in seqs:
+        offsets.append(offsets[-1] + len(s))
+    o = ["/* Generado por snippet_gen.py desde assets/snippets.txt. NO editar a mano. */",
+         "#pragma once",
+         "#include <avr/pgmspace.h>",
+         "",
+         "#define SNIPPET_COUNT %d" % len(snippets),
+         "#define SNIPPET_STACK %d   // altura máxima de la pila al expandir" % stack,
+         "",
+         "/* código 0x80 + i -> par de símbolos (ASCII o código) */",
+         "static const uint8_t PROGMEM snippet_dict[%d][2] = {" % max(len(pairs), 1)]
+    for i, (a, b) in enumerate(pairs):
+        o.append("  { 0x%02x, 0x%02x },  /* #%d = %s %s */" % (a, b, i, label(a), label(b)))
+    if not pairs:
+        o.append("  { 0, 0 },")
+    o += ["};", "",
+          "static const uint8_t PROGMEM snippet_data[%d] = {" % len(data)]
+    for (name, text), s in zip(snippets, seqs):
+        o.append("  /* %s: %s */" % (name, c_comment(text)))
+        for i in range(0, len(s), 12):
+            o.append("  " + ", ".join("0x%02x" % b for b in s[i:i + 12]) + ",")
+    o += ["};", "",
+          "static const uint16_t PROGMEM snippet_offset[SNIPPET_COUNT + 1] = {"]
+    for i in range(0, len(offsets), 12):
+        o.append("  " + ", ".join("%d" % v for v in offsets[i:i + 12]) + ",")
+    o.append("};")
+    return "\n".join(o) + "\n"
+
+def main():
+    ap = argparse.ArgumentParser(description="Snippets comprimidos en PROGMEM para snippets.c")
+    ap.add_argument("--src", default=str(SRC), help="lista de snippets")
+    ap.add_argument("--out", default=str(OUT))
+    ap.add_argument("--check", action="store_true", help="solo verifica que el .h esté al día")
+    ap.add_argument("--show", action="store_true", help="imprime el diccionario y los snippets")
+    args = ap.parse_args()
+
+    snippets = parse_snippets(Path(args.src).read_text(encoding="utf-8"))
+    names = [n for n, _t in snippets]
+    if names != enum_snippets():
+        sys.exit("❌ los SNIP_* de bodegafresh_keycodes.h no coinciden con snippets.txt:\n"
+                 f"   enum:     {' '.join(enum_snippets())}\n   snippets: {' '.join(names)}")
+    if len(snippets) > 255:
+        sys.exit("❌ máximo 255 snippets")
+    for name, text in snippets:
+        bad = sorted({c for c in text if ord(c) not in SENDABLE})
+        if bad:
+            sys.exit(f"❌ {name}: send_latam.c no escribe {' '.join(map(repr, bad))}")
+
+    pairs, seqs = compress([t for _n, t in snippets])
+    stack = 1
+    for (name, text), s in zip(snippets, seqs):
+        back, top = decode(pairs, s)
+        assert back == text, name
+        stack = max(stack, top)
+
+    if args.show:
+        for i, (a, b) in enumerate(pairs):
+            print(f"#{i:<3} {label(a):>4} {label(b):<4} = {decode(pairs, [FIRST_CODE + i])[0]!r}")
+        for (name, text), s in zip(snippets, seqs):
+            print(f"SNIP_{name:<14} {len(text):3d} -> {len(s):3d}  {text!r}")
+        return
+
+    text = render(snippets, pairs, seqs, stack)
+    out = Path(args.out)
+    if args.check:
+        if not out.exists() or out.read_text(encoding="utf-8") != text:
+            print(f"❌ {out.name} desactualizado: python3 snippet_gen.py"); sys.exit(1)
+        print(f"✅ {out.name} al día.")
+        return
+    out.write_text(text, encoding="utf-8")
+    plain = sum(len(t) + 1 for _n, t in snippets)
+    packed = 2 * len(pairs) + sum(len(s) for s in seqs) + 2 * (len(snippets) + 1)
+    print(f"{out.name}: {len(snippets)} snippets, {plain} bytes como strings -> {packed} bytes "
+          f"({len(pairs)} pares, pila {stack})", file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
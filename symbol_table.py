@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+symbol_table.py
+Lee y cambia en caliente la tabla de símbolos del firmware (keymaps/symbol_table.c) por
+Raw HID: qué keycode manda cada SYM_*, ES_* y operador. El cambio se aplica al instante
+y queda en EEPROM; no hace falta compilar ni flashear.
+
+Los nombres salen del enum custom_keycodes (bodegafresh_keycodes.h) y los defaults de
+symbol_table.c; el listado marca con * lo que difiere del default compilado.
+
+Perfiles (enum symbol_profile): uno por layout del host. Solo LATAM se edita; los otros
+son fijos en flash. layout_daemon.py cambia el perfil solo según el layout activo.
+
+Requisitos: hidapi (pip install hidapi); --defaults funciona sin teclado.
+Uso:
+  python3 symbol_table.py                              # tabla actual del teclado
+  python3 symbol_table.py set SYM_RBRC "RALT(KC_0)"
+  python3 symbol_table.py set ES_NTIL KC_SCLN "S(KC_SCLN)"   # con Shift manda el segundo
+  python3 symbol_table.py reset                        # vuelve a los defaults
+  python3 symbol_table.py profile us                   # perfil activo (sin nombre: consulta)
+  python3 symbol_table.py --defaults                   # solo los defaults del código
+  python3 symbol_table.py --defaults --profile us
+  python3 symbol_table.py --json
+"""
+
+import re, sys, json, struct, argparse
+
+from keymap_sparse_gen import strip_comments, split_args
+from qmk_keycodes import parse, name
+from raw_hid import (RawHid, RawHidError, CMD_SYM_INFO, CMD_SYM_GET, CMD_SYM_SET, CMD_SYM_RESET,
+                     CMD_SYM_PROFILE, LILY58_VID, LILY58_PID, parse_int)
+from oled_emulator import KEYMAP_DIR
+
+def symbol_names():
+    """Nombres de SYMBOL_FIRST a SYMBOL_LAST en el orden del enum."""
+    keycodes = strip_comments((KEYMAP_DIR / "bodegafresh_keycodes.h").read_text(encoding="utf-8"))
+    body = re.search(r"enum\s+custom_keycodes\s*\{([^}]*)\}", keycodes).group(1)
+    names = [re.match(r"\s*(\w+)", item).group(1) for item in body.split(",") if item.strip()]
+    header = (KEYMAP_DIR / "symbol_table.h").read_text(encoding="utf-8")
+    first = re.search(r"#define\s+SYMBOL_FIRST\s+(\w+)", header).group(1)
+    last = re.search(r"#define\s+SYMBOL_LAST\s+(\w+)", header).group(1)
+    return names[names.index(first):names.index(last) + 1]
+
+def profile_names():
+    """['latam', 'us', ...] en el orden de enum symbol_profile."""
+    header = strip_comments((KEYMAP_DIR / "symbol_table.h").read_text(encoding="utf-8"))
+    body = re.search(r"enum\s+symbol_profile\s*\{([^}]*)\}", header).group(1)
+    return [m.group(1).lower() for m in re.finditer(r"SYMBOL_PROFILE_(\w+)", body)]
+
+def symbol_defaults(profile="latam"):
+    """{nombre: (tap, shifted)} desde las líneas SYM(...) de symbol_<perfil>[] en symbol_table.c."""
+    src = strip_comments((KEYMAP_DIR / "symbol_table.c").read_text(encoding="utf-8"))
+    src = re.search(r"\bsymbol_%s\[[^]]*\]\s*=\s*\{(.*?)\n\};" % profile, src, flags=re.S).group(1)
+    out = {}
+    for m in re.finditer(r"\bSYM\((\w+),(.*?)\),?\s*$", src, flags=re.M):
+        args = [parse(a) for a in split_args(m.group(2))]
+        out[m.group(1)] = (args[0], args[1] if len(args) > 1 else 0)
+    return out
+
+def read_table(kb, count):
+    table, index = [], 0
+    while index < count:
+        data = kb.call(CMD_SYM_GET, index, count - index)
+        n = data[1]
+        table += [struct.unpack_from("<HH", data, 2 + 4 * i) for i in range(n)]
+        index += n
+    return table
+
+def print_table(names, table, defaults):
+    print(f"{'keycode':<14} {'tap':<20} {'con Shift':<20}")
+    for n, (tap, shifted) in zip(names, table):
+        mark = " *" if defaults.get(n, (tap, shifted)) != (tap, shifted) else ""
+        print(f"{n:<14} {name(tap):<20} {name(shifted) if shifted else '-':<20}{mark}")
+
+def main():
+    ap = argparse.ArgumentParser(description="Tabla de símbolos del firmware por Raw HID")
+    ap.add_argument("cmd", nargs="?", choices=["list", "set", "reset", "profile"], default="list")
+    ap.add_argument("args", nargs="*", help="set: NOMBRE TAP [CON_SHIFT]; profile: [PERFIL]")
+    ap.add_argument("--vid", type=parse_int, default=LILY58_VID)
+    ap.add_argument("--pid", type=parse_int, default=LILY58_PID)
+    ap.add_argument("--defaults", action="store_true", help="muestra los defaults del código, sin teclado")
+    ap.add_argument("--profile", default="latam", help="perfil de --defaults")
+    ap.add_argument("--json", action="store_true")
+    args = ap.parse_args()
+
+    names, profiles = symbol_names(), profile_names()
+    if args.defaults:
+        if args.profile not in profiles:
+            ap.error(f"--profile: {', '.join(profiles)}")
+        profile = args.profile
+        defaults = symbol_defaults(profile)
+        table = [defaults[n] for n in names]
+    else:
+        try:
+            with RawHid(args.vid, args.pid) as kb:
+                count, first = struct.unpack_from("<BH", kb.call(CMD_SYM_INFO))
+                if count != len(names):
+                    sys.exit(f"❌ el firmware tiene {count} símbolos y el código {len(names)}: "
+                             "¿flasheaste la versión actual?")
+                if args.cmd == "set":
+                    if len(args.args) not in (2, 3):
+                        ap.error("set NOMBRE TAP [CON_SHIFT]")
+                    if args.args[0] not in names:
+                        sys.exit(f"❌ {args.args[0]} no está en la tabla ({names[0]}..{names[-1]})")
+                    try:
+                        tap = parse(args.args[1])
+                        shifted = parse(args.args[2]) if len(args.args) == 3 else 0
+                    except ValueError as e:
+                        sys.exit(f"❌ {e}")
+                    kb.call(CMD_SYM_SET, names.index(args.args[0]), *struct.pack("<HH", tap, shifted))
+                    print(f"✅ {args.args[0]} = {name(tap)}" + (f" / {name(shifted)}" if shifted else ""))
+                    return
+                if args.cmd == "reset":
+                    kb.call(CMD_SYM_RESET)
+                    print("✅ tabla en los defaults de symbol_table.c.")
+                    return
+                if args.cmd == "profile" and args.args:
+                    if args.args[0] not in profiles:
+                        sys.exit(f"❌ perfiles: {', '.join(profiles)}")
+                    kb.call(CMD_SYM_PROFILE, profiles.index(args.args[0]))
+                profile = profiles[kb.call(CMD_SYM_PROFILE, 0xFF)[0]]
+                if args.cmd == "profile":
+                    print(f"perfil activo: {profile}")
+                    return
+                table = read_table(kb, count)
+                defaults = symbol_defaults(profile)
+        except RawHidError as e:
+            sys.exit(f"❌ {e}")
+
+    if args.json:
+        print(json.dumps({"profile": profile,
+                          "symbols": {n: {"tap": name(t), "shifted": name(s) if s else None}
+                                      for n, (t, s) in zip(names, table)}}, sort_keys=True))
+    else:
+        print(f"perfil: {profile}")
+        print_table(names, table, defaults)
+
+if __name__ == "__main__":
+    main()